@@ -3,11 +3,30 @@
 // Standard Library Headers
 #include <array>
 #include <cstdint>
+#include <vector>
 // Project Headers
+#include "blip-buffer.hpp"
 #include "nes-sound.hpp"
+#include "save-state.hpp"
+#include "perf-counters.hpp"
+// Project Defines
+// APU is clocked every CPU clock
+#define APU_NTSC_CLOCK_RATE 1789773
+#define APU_PAL_CLOCK_RATE  1662607
+// Steps of a frame sequencer sequence, the last step is also the first cycle of the next sequence
+#define APU_SEQUENCER_STEP_COUNT 6
+// Maximum number of samples synthesized between two calls to endAudioFrame
+#define APU_AUDIO_BUFFER_SIZE 4096
+// Amplitude of the mixer output of 1.0f in the audio buffer
+#define APU_AUDIO_AMPLITUDE 32767
 
 class APU {
 public:
+    enum class Region {
+        NTSC = 0,
+        PAL = 1,
+    };
+
     struct Timer {
         Timer();
         void clock();
@@ -70,7 +89,8 @@ public:
 
         // Methods
         explicit PulseChannel(void (*timer_period_modifier)(uint16_t& timer_reload, const uint16_t& change));
-        void clockTimer();
+        // Returns true if the output may have changed
+        bool clockTimer();
         void clockSweep();
         uint8_t getOutput() const;
 
@@ -98,7 +118,8 @@ public:
 
         // Methods
         TriangleChannel();
-        void clockTimer();
+        // Returns true if the output may have changed
+        bool clockTimer();
         void clockLengthCounter();
         void clockLinearCounter();
         uint8_t getOutput() const;
@@ -118,6 +139,15 @@ public:
     } dmc_channel;
 
     APU();
+
+    /**
+     * @brief  Sets the region of the console, which decides the clock rate and the frame sequencer timing
+     *   The frame sequencer restarts, the region is NTSC until set
+     * @param  region: The region to set
+     * @return None
+    */
+    void setRegion(const Region& region);
+
     // Read APU Register
     uint8_t readAPURegister(const uint8_t& address);
     // Write APU Register
@@ -132,6 +162,21 @@ public:
     // run APU Cycle
     void clockAPU();
 
+    /**
+     * @brief  Gets the number of cycles until the next frame sequencer step
+     * @param  None
+     * @return Number of cycles
+    */
+    uint16_t getCyclesUntilSequencerStep() const;
+
+    /**
+     * @brief  Outputs the samples of the cycles ran since the last call to the Sound System
+     *   Called at the end of every frame, the samples are also output when the audio buffer is about to fill up
+     * @param  None
+     * @return None
+    */
+    void endAudioFrame();
+
     /**
      * @brief  Connects Sound System
      * @param  sound_system: sound system to connect to
@@ -139,6 +184,34 @@ public:
     */
     void connectSoundSystem(NESSound& sound_system);
 
+    /**
+     * @brief  Disconnects the Sound System, samples are no longer output
+     * @param  None
+     * @return None
+    */
+    void disconnectSoundSystem();
+
+    /**
+     * @brief  Connects the performance counters the APU cycles are timed to
+     * @param  perf_counters: The counters to record to, nullptr to stop recording
+     * @return None
+    */
+    void connectPerfCounters(PerfCounters* perf_counters);
+
+    /**
+     * @brief  Saves the state of the APU and its channels
+     * @param  writer: The writer to save the state to
+     * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+     * @brief  Loads the state of the APU and its channels
+     * @param  reader: The reader to load the state from
+     * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
     // Mixer Functions
     float samplePulseOut(const uint8_t& pulse_1, const uint8_t& pulse_2) const;
     float sampleTNDOut(const uint8_t& triangle, const uint8_t& noise, const uint8_t& dmc) const;
@@ -155,7 +228,18 @@ private:
     static const std::array<float, 31> pulse_table;
     static const std::array<float, 203> tnd_table;
 
+    // Frame sequencer steps, timed in CPU cycles from the start of the sequence
+    struct SequencerStep {
+        uint16_t cycle;
+        bool is_quarter_frame;
+        bool is_half_frame;
+        bool is_frame_irq;
+    };
+    // Steps for each region and sequencer mode, from NESDev Wiki
+    static const std::array<std::array<std::array<SequencerStep, APU_SEQUENCER_STEP_COUNT>, 2>, 2> s_sequencer_steps;
+
     uint64_t clock_count_;
+    Region region_;
     
     // Sequencer Value
     uint8_t sequencer_value_;
@@ -163,12 +247,43 @@ private:
         FourStep = 0,
         FiveStep = 1,
     } sequencer_mode_;
+    // Number of cycles until the next sequencer step
+    uint16_t sequencer_countdown_;
     
     bool irq_inhibit_;
     bool frame_irq_;
     bool irq_requested_;
 
     NESSound* sound_system_;
+    PerfCounters* perf_counters_;
+
+    // Audio output, band-limited from the changes of the mixer output
+    //   Only runs while a Sound System is connected
+    BlipBuffer audio_buffer_;
+    std::vector<int32_t> audio_samples_;
+    // Number of cycles since the last audio frame ended
+    uint32_t audio_clock_count_;
+    uint32_t audio_max_clock_count_;
+    // Set when a channel output may have changed since it was last recorded
+    bool is_audio_output_changed_;
+    // Mixer inputs and amplitude last recorded in the audio buffer
+    uint8_t audio_pulse_input_;
+    uint8_t audio_tnd_input_;
+    int32_t audio_amplitude_;
+
+    /**
+     * @brief  Records the mixer output in the audio buffer if it changed
+     * @param  None
+     * @return None
+    */
+    void updateAudioOutput();
+
+    /**
+     * @brief  Restarts the frame sequencer from its first step
+     * @param  None
+     * @return None
+    */
+    void resetSequencer();
     
     PulseChannel pulse_1_channel{pulseOneTimerPeriodNegateModifier};
     PulseChannel pulse_2_channel{pulseTwoTimerPeriodNegateModifier};
@@ -0,0 +1,124 @@
+#ifndef _BLIP_BUFFER_HPP_
+#define _BLIP_BUFFER_HPP_
+// Standard Library Headers
+#include <array>
+#include <cstdint>
+#include <vector>
+// Project Headers
+#include "save-state.hpp"
+// Project Defines
+// Number of output samples each amplitude step is spread over
+#define BLIP_BUFFER_KERNEL_WIDTH 16
+// Number of sub-sample positions a step can start at
+#define BLIP_BUFFER_PHASE_BITS 6
+#define BLIP_BUFFER_PHASE_COUNT (1 << BLIP_BUFFER_PHASE_BITS)
+// Fixed point precision of the kernel, every phase of the kernel adds up to 1 << BLIP_BUFFER_KERNEL_BITS
+#define BLIP_BUFFER_KERNEL_BITS 14
+// Fixed point precision of the time of an output sample
+#define BLIP_BUFFER_TIME_BITS 32
+
+// Synthesizes band-limited samples from changes of an amplitude that is stepped at a clock rate
+//   Each change is recorded as a delta at the clock it happens on, and spread over the nearby output samples
+//   through a windowed sinc kernel, so the steps don't alias when the output is read at a lower rate
+//   Amplitudes are integers, so reading the samples back adds up every delta exactly
+class BlipBuffer {
+public:
+    /**
+    * @brief  Constructor for BlipBuffer, all the memory of the buffer is allocated here
+    * @param  clock_rate: Rate of the clock that amplitude changes are timed by, in Hz
+    * @param  sample_rate: Rate of the output samples, in Hz
+    * @param  sample_capacity: Maximum number of output samples waiting to be read
+    * @return None
+    */
+    BlipBuffer(const uint32_t& clock_rate, const uint32_t& sample_rate, const uint32_t& sample_capacity);
+
+    /**
+    * @brief  Changes the rate of the clock that amplitude changes are timed by
+    * @param  clock_rate: Rate of the clock, in Hz
+    * @return None
+    */
+    void setClockRate(const uint32_t& clock_rate);
+
+    /**
+    * @brief  Records a change of the amplitude
+    * @param  clock: Clock the change happens on, counted from the end of the last frame
+    * @param  delta: Change of the amplitude
+    * @return None
+    */
+    void addDelta(const uint32_t& clock, const int32_t& delta);
+
+    /**
+    * @brief  Ends a frame, so the samples before its end can be read
+    *   The frame must not make more samples than the buffer has room for
+    * @param  clock_count: Number of clocks in the frame
+    * @return None
+    */
+    void endFrame(const uint32_t& clock_count);
+
+    /**
+    * @brief  Gets the number of samples that can be read
+    * @param  None
+    * @return Number of samples
+    */
+    uint32_t getSampleCount() const;
+
+    /**
+    * @brief  Gets the largest number of clocks a frame can have while the buffer is full of unread samples
+    * @param  None
+    * @return Number of clocks
+    */
+    uint32_t getMaxFrameClockCount() const;
+
+    /**
+    * @brief  Reads and removes the oldest samples
+    * @param  samples: Buffer of sample_count samples to write to
+    * @param  sample_count: Maximum number of samples to read
+    * @return Number of samples read
+    */
+    uint32_t readSamples(int32_t* samples, const uint32_t& sample_count);
+
+    /**
+    * @brief  Removes every sample and recorded change, the amplitude goes back to 0
+    * @param  None
+    * @return None
+    */
+    void clear();
+
+    /**
+    * @brief  Saves the amplitude and the part of the kernels spread past the end of the last frame
+    *   Samples that weren't read and changes recorded after the end of the last frame are not saved
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the amplitude and the part of the kernels spread past the end of the last frame
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
+private:
+    using Kernel = std::array<std::array<int32_t, BLIP_BUFFER_KERNEL_WIDTH>, BLIP_BUFFER_PHASE_COUNT>;
+
+    const uint32_t sample_rate_;
+    // Output samples per clock, in fixed point
+    uint64_t clock_to_sample_factor_;
+    const uint32_t sample_capacity_;
+    // Position of the end of the last frame, in fixed point output samples
+    uint64_t frame_end_time_;
+    // Deltas spread over the output samples, with room for the kernel past the last sample
+    std::vector<int32_t> deltas_;
+    // Sum of every delta read so far
+    int32_t amplitude_;
+
+    /**
+    * @brief  Gets the kernel for each phase, built on the first call
+    * @param  None
+    * @return The kernel
+    */
+    static const Kernel& getKernel();
+};
+
+#endif
@@ -3,10 +3,15 @@
 // Standard Library Headers
 #include <istream>
 #include <memory>
+#include <string>
 #include <cstdint>
 // Project Headers
 #include "mapper.hpp"
 #include "memory-unit.hpp"
+#include "rom-image.hpp"
+// Project Defines
+// Cartridges without CHR ROM have 8KB of CHR RAM instead
+#define CARTRIDGE_CHR_RAM_SIZE 0x2000
 
 class Cartridge {
 public:
@@ -37,6 +42,21 @@ public:
     */
     static std::unique_ptr<Cartridge> makeCartridge(std::istream& rom_data_stream);
 
+    /**
+    * @brief  Factory Method for creating an instance of a cartridge from a ROM file, without reading the ROM
+    *   The file is memory-mapped and the header is parsed in place, the PRG and CHR ROM point into the mapping
+    * @param  path: The file path to the ROM
+    * @return A unique pointer to the created Cartridge instance, nullptr if the ROM can't be loaded
+    */
+    static std::unique_ptr<Cartridge> makeCartridge(const std::string& path);
+
+    /**
+    * @brief  Gets the ROM image of the cartridge, shared with the other cartridges of the same ROM
+    * @param  None
+    * @return The ROM image
+    */
+    const RomImage& getRomImage() const;
+
     /**
     * @brief  Reads the program rom and ram data from the Cartridge at the address
     * @param  address: The address to read from
@@ -44,6 +64,13 @@ public:
     */
     uint8_t readPrgMem(const uint16_t& address) const;
 
+    /**
+    * @brief  Gets the program rom or ram memory mapped at the page of the address
+    * @param  address: The address of the start of the page
+    * @return Pointer to the memory of the page
+    */
+    const uint8_t* getPrgMemPage(const uint16_t& address) const;
+
     /**
     * @brief  Writes data to the Cartridge WRAM at the address
     * @param  address: The address to write to
@@ -59,11 +86,18 @@ public:
     */
     uint8_t readChrMem(const uint16_t& address) const;
 
+    /**
+    * @brief  Gets the pattern table memory mapped at the page of the address
+    * @param  address: The address of the start of the page
+    * @return Pointer to the memory of the page
+    */
+    const uint8_t* getChrMemPage(const uint16_t& address) const;
+
     /**
     * @brief  Writes data to the Cartridge Pattern Table at the address
     * @param  address: The address to write to
     * @param  data: The data to write
-    * @return True if successfully written, false otherwise
+    * @return True if successfully written, false if the pattern table is CHR ROM
     */
     bool writeToChrMem(const uint16_t& address, const uint8_t& data);
 
@@ -74,16 +108,50 @@ public:
     */
     MirrorMode getMirrorMode() const;
 
+    /**
+    * @brief  Saves the state of the Cartridge PRG RAM, CHR RAM and Mapper
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the state of the Cartridge
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 protected:
     // Constructor
-    explicit Cartridge(const uint8_t& mapper_id, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size, const MirrorMode& mirror_mode);
+    explicit Cartridge(const uint8_t& mapper_id, std::shared_ptr<const RomImage> rom_image, const MirrorMode& mirror_mode);
 
 private:
+    // Where the parts of the ROM are, as described by the header
+    struct RomLayout {
+        uint8_t mapper_id;
+        MirrorMode mirror_mode;
+        uint32_t trainer_size;
+        uint32_t prg_rom_size;
+        uint32_t chr_rom_size;
+    };
+
     MemoryUnit prg_ram_memory_;
-    MemoryUnit prg_rom_memory_;
-    MemoryUnit chr_memory_;
+    std::shared_ptr<const RomImage> rom_image_;
+    // Empty when the pattern table is the CHR ROM of the image
+    MemoryUnit chr_ram_memory_;
+    // Either the CHR ROM or the CHR RAM
+    const uint8_t* chr_memory_;
     std::unique_ptr<Mapper> mapper_;
     MirrorMode mirror_mode_;
+
+    /**
+    * @brief  Parses the iNES header of a ROM
+    * @param  header: The header to parse
+    * @param  layout: Set to the layout of the ROM
+    * @return True if the file type is supported, false otherwise
+    */
+    static bool parseHeader(const Header& header, RomLayout& layout);
 };
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef _CONTROLLER_HPP_
 #define _CONTROLLER_HPP_
 #include <cstdint>
+// Project Headers
+#include "save-state.hpp"
 
 class Controller {
 public:
@@ -65,6 +67,21 @@ public:
     */
     uint8_t popBitFromShiftRegister();
 
+    /**
+     * @brief  Saves the state of the shift register
+     *   The button state is input from the host, so it is not part of the state
+     * @param  writer: The writer to save the state to
+     * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+     * @brief  Loads the state of the shift register
+     * @param  reader: The reader to load the state from
+     * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 private:
     uint8_t button_state_;
     uint8_t shift_register_;
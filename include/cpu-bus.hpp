@@ -7,9 +7,12 @@
 #include "cartridge.hpp"
 #include "controller.hpp"
 #include "memory-unit.hpp"
+#include "perf-counters.hpp"
 // Project Defines
 #define CPU_BUS_RAM_SIZE 0x0800
 #define CPU_BUS_PPU_SIZE 0x0008
+#define CPU_BUS_PAGE_SIZE 0x0100
+#define CPU_BUS_PAGE_COUNT 0x0100
 
 class CPUBUS : public BUS {
 public:
@@ -45,12 +48,63 @@ public:
     */
     bool connectController(Controller* controller);
 
+    /**
+    * @brief  Connects the performance counters the bus accesses are counted to
+    * @param  perf_counters: The counters to record to, nullptr to stop recording
+    * @return None
+    */
+    void connectPerfCounters(PerfCounters* perf_counters);
+
+    /**
+    * @brief  Maps the pages of the cartridge into the page table
+    *   Must be called when a cartridge is loaded or released, and when the mapper switches banks
+    * @param  None
+    * @return None
+    */
+    void mapCartridgePages();
+
+    /**
+    * @brief  Saves the state of the connected controllers
+    *   Slots without a controller save the state of an idle controller, so the state size doesn't depend on them
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the state of the connected controllers
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 private:
     RP2A03& cpu_;
     MemoryUnit& ram_;
     RP2C02& ppu_;
     const std::unique_ptr<Cartridge>& cartridge_;
     std::array<Controller*, 2> controllers_;
+
+    // Host pointers to the memory behind each page of the address space
+    //   Pages without a pointer are handled by readIOData and writeIOData
+    std::array<const uint8_t*, CPU_BUS_PAGE_COUNT> read_page_table_;
+    std::array<uint8_t*, CPU_BUS_PAGE_COUNT> write_page_table_;
+    PerfCounters* perf_counters_;
+
+    /**
+    * @brief  Reads data from the registers and unmapped pages at the address
+    * @param  address: The address to read from
+    * @return Data read from the bus
+    */
+    uint8_t readIOData(const uint16_t& address) const;
+
+    /**
+    * @brief  Writes data to the registers and unmapped pages at the address
+    * @param  address: The address to write to
+    * @param  data: The data to write
+    * @return True if successfully written, false otherwise
+    */
+    bool writeIOData(const uint16_t& address, const uint8_t& data);
 };
 
 #endif
@@ -0,0 +1,49 @@
+#ifndef _MAPPED_FILE_HPP_
+#define _MAPPED_FILE_HPP_
+// Standard Library Headers
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Read-only view of a whole file, memory-mapped so opening it doesn't read it
+//   Platforms without mmap read the file into memory instead
+class MappedFile {
+public:
+    /**
+    * @brief  Maps a file into memory
+    * @param  path: The file path to map
+    * @return A shared pointer to the mapped file, nullptr if the file can't be opened or is empty
+    */
+    static std::shared_ptr<const MappedFile> mapFile(const std::string& path);
+
+    // Destructor, unmaps the file
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+    * @brief  Gets the content of the file
+    * @param  None
+    * @return Pointer to the first byte of the file
+    */
+    const uint8_t* getData() const;
+
+    /**
+    * @brief  Gets the size of the file
+    * @param  None
+    * @return The size of the file in bytes
+    */
+    uint64_t getSize() const;
+
+private:
+    const uint8_t* data_;
+    const uint64_t size_;
+    // Owns the content when the file is read instead of mapped
+    std::unique_ptr<uint8_t[]> read_data_;
+
+    // Constructor
+    MappedFile(const uint8_t* data, const uint64_t& size, std::unique_ptr<uint8_t[]> read_data);
+};
+
+#endif
@@ -3,6 +3,8 @@
 // Standard Library Headers
 #include <memory>
 #include <cstdint>
+// Project Headers
+#include "save-state.hpp"
 // Project Define
 // 0x0000 to 0x1FFF is reserved for PRG RAM
 #define MAPPER_PRG_RAM_REGION_SIZE 0x2000
@@ -24,6 +26,7 @@ public:
 
     /*
     * @brief  Returns the mapped address for the CPU to read from the Cartridge
+    *   The CPU BUS maps whole 256 byte pages, so the mapping must be contiguous within a page
     * @param  address: The address to read from
     * @return Mapped address
     */
@@ -38,6 +41,7 @@ public:
 
     /*
     * @brief  Returns the mapped address for the PPU to read from the Cartridge
+    *   The PPU BUS maps whole 1KB pages, so the mapping must be contiguous within a page
     * @param  address: The address to read from
     * @return Mapped Address
     */
@@ -50,6 +54,20 @@ public:
     */
     virtual uint16_t mapPPUWriteAddress(const uint16_t& address) const = 0;
 
+    /*
+    * @brief  Saves the state of the Mapper registers, mappers without registers save nothing
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    virtual void saveState(SaveStateWriter& writer) const;
+
+    /*
+    * @brief  Loads the state of the Mapper registers
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    virtual void loadState(SaveStateReader& reader);
+
 protected:
     const uint32_t prg_ram_size_;
     const uint32_t prg_rom_size_;
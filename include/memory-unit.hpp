@@ -4,6 +4,8 @@
 // #include <fstream>
 #include <memory>
 #include <cstdint>
+// Project Headers
+#include "save-state.hpp"
 
 class MemoryUnit {
 public:
@@ -43,6 +45,20 @@ public:
     */
     uint32_t getSize() const;
 
+    /**
+    * @brief  Saves the state of the memory block
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the state of the memory block
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 private:
     const uint32_t byte_size_;
     std::unique_ptr<uint8_t[]> memory_block_;
@@ -4,15 +4,17 @@
 #include <cstdint>
 #include <ostream>
 #include <array>
-#include <variant>
+#include <utility>
 // Project Headers
 #include "bus.hpp"
+#include "save-state.hpp"
 
 #define MOS6502_NMI_PC_ADDRESS 0xFFFA
 #define MOS6502_STARTING_PC_ADDRESS 0xFFFC
 #define MOS6502_IRQ_PC_ADDRESS 0xFFFE
 
 #define MOS6502_NUMBER_OF_INSTRUCTIONS 256
+#define MOS6502_MAX_INSTRUCTION_CYCLES 8
 #define MOS6502_CLOCK_SPEED 1.789773 // In MHz
 #define MOS6502_CLOCK_PERIOD 558.73007 // In nanoseconds per cycle
 
@@ -24,7 +26,7 @@ public:
     };
 
     struct Instruction {
-        const std::string name;
+        const char* name;
         CycleType (*operationFn)(MOS6502& cpu);
         uint8_t (*addressingMode)(MOS6502& cpu);
         uint8_t cycles;
@@ -39,9 +41,15 @@ public:
         uint8_t processor_status;
     };
 
+    // Executes a fetched opcode
+    using OpcodeHandler = void (*)(MOS6502& cpu);
+
     // Usage: Maps OPCODE to Instruction
     static const std::array<Instruction, MOS6502_NUMBER_OF_INSTRUCTIONS> instruction_lookup_table;
 
+    // Usage: Maps OPCODE to its handler, generated from instruction_lookup_table at compile time
+    static const std::array<OpcodeHandler, MOS6502_NUMBER_OF_INSTRUCTIONS> opcode_handler_table;
+
     /**
     * @brief  Constructor for MOS6502
     * @param  None
@@ -58,10 +66,11 @@ public:
 
     /**
     * @brief  Run 1 instruction of the CPU
+    *   If an instruction is already in progress, only its remaining cycles are run
     * @param  None
-    * @return None
+    * @return Number of cycles the instruction took
     */
-    void runInstruction();
+    uint8_t runInstruction();
 
     /**
     * @brief  Run 1 cycle of the CPU
@@ -119,6 +128,21 @@ public:
     */
     void setState(const State& new_state);
 
+    /**
+    * @brief  Saves the state of the CPU
+    *   Includes the progress of the current instruction, unlike getState
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the state of the CPU
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
     /**
     * @brief  Output the current CPU state
     * @param  out: The output stream
@@ -142,33 +166,6 @@ public:
     bool writeMemory(const uint16_t& address, const uint8_t& data);
 
 protected:
-    // Class for mos6502 address pointer using similar idea as an iterator
-    //   It can point to a virtual address or a register
-    class Pointer {
-    public:
-        enum class Register {
-            ACCUMULATOR,
-        };
-        // Gets the current target location that is being pointed to
-        const std::variant<uint16_t, Register>& get() const;
-        //Read Write Operations
-        uint8_t read() const;
-        void write(const uint8_t& data);
-        // Operator Overloads
-        void operator=(const uint16_t& virtual_address);
-        void operator=(const Register& target_register);
-        Pointer& operator++();
-        Pointer& operator+=(const int16_t& increment);
-        // Friend Declarations
-        friend class MOS6502;
-
-    private:
-        MOS6502& cpu_;
-        std::variant<uint16_t, Register> target_location_;
-        explicit Pointer(MOS6502& cpu, const uint16_t& virtual_address);
-        explicit Pointer(MOS6502& cpu, const Register& target_register);
-    };
-
     enum class StatusFlag {
         CARRY = 0,
         ZERO,
@@ -212,9 +209,34 @@ protected:
     uint8_t instruction_cycle_remaining_; // Cycles remaining for the current instruction to complete
     
     // Variables that emulates the data carried on a data-path
-    Pointer operand_address_;
+    uint16_t operand_address_;
     int8_t relative_addressing_offset_;
 
+    /**
+    * @brief  Executes an opcode whose addressing mode and operation are known at compile time
+    *   This lets the compiler inline the addressing mode and the operation into a single handler
+    * @param  cpu: Target CPU
+    * @return None
+    */
+    template<uint8_t (*AddressingMode)(MOS6502& cpu), CycleType (*Operation)(MOS6502& cpu), uint8_t Cycles>
+    static void executeOpcode(MOS6502& cpu);
+
+    /**
+    * @brief  Generates the handler of every opcode from instruction_lookup_table
+    * @param  None
+    * @return Handlers indexed by opcode
+    */
+    template<std::size_t... Opcodes>
+    static constexpr std::array<OpcodeHandler, MOS6502_NUMBER_OF_INSTRUCTIONS> makeOpcodeHandlerTable(std::index_sequence<Opcodes...>);
+
+    /**
+    * @brief  Fetches, decodes and executes the instruction at the program counter
+    *   Sets the number of cycles remaining for the instruction to complete
+    * @param  None
+    * @return None
+    */
+    void executeInstruction();
+
     /**
     * @brief  Gets the value of the given processor status flag
     * @param  flag: status flag to get value from
@@ -265,6 +287,13 @@ protected:
     */
     static CycleType ASL(MOS6502& cpu);
 
+    /**
+    * @brief  Executes ASL Instruction on the Accumulator
+    * @param  cpu: Target CPU
+    * @return CycleType of this instruction
+    */
+    static CycleType ASL_ACC(MOS6502& cpu);
+
     /**
     * @brief  Executes BCC Instruction
     * @param  cpu: Target CPU
@@ -474,6 +503,13 @@ protected:
     * @return CycleType of this instruction
     */
     static CycleType LSR(MOS6502& cpu);
+
+    /**
+    * @brief  Executes LSR Instruction on the Accumulator
+    * @param  cpu: Target CPU
+    * @return CycleType of this instruction
+    */
+    static CycleType LSR_ACC(MOS6502& cpu);
     
     /**
     * @brief  Executes NOP Instruction
@@ -524,12 +560,26 @@ protected:
     */
     static CycleType ROL(MOS6502& cpu);
 
+    /**
+    * @brief  Executes ROL Instruction on the Accumulator
+    * @param  cpu: Target CPU
+    * @return CycleType of this instruction
+    */
+    static CycleType ROL_ACC(MOS6502& cpu);
+
     /**
     * @brief  Executes ROR Instruction
     * @param  cpu: Target CPU
     * @return CycleType of this instruction
     */
     static CycleType ROR(MOS6502& cpu);
+
+    /**
+    * @brief  Executes ROR Instruction on the Accumulator
+    * @param  cpu: Target CPU
+    * @return CycleType of this instruction
+    */
+    static CycleType ROR_ACC(MOS6502& cpu);
     
     /**
     * @brief  Executes RTI Instruction
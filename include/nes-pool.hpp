@@ -0,0 +1,151 @@
+#ifndef _NES_POOL_HPP_
+#define _NES_POOL_HPP_
+// Standard Library Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+// Project Headers
+#include "nes.hpp"
+#include "nes-window-null.hpp"
+#include "nes-sound-buffer.hpp"
+#include "controller.hpp"
+// Project Defines
+// Samples kept per instance between steps, enough for several frames
+#define NES_POOL_DEFAULT_SOUND_BUFFER_SIZE (NES_SOUND_SAMPLE_PER_FRAME * 8)
+
+// Runs many independent NES systems in parallel, for batch play-testing and rollouts
+//   NES systems share no mutable state, so each instance is only ever stepped by 1 worker thread at a time
+//   Workers own a range of the instances, and steal instances from the other ranges once theirs is done
+class NESPool {
+public:
+    /**
+    * @brief  Constructor for NESPool, starts the worker threads
+    * @param  instance_count: Number of NES systems to run
+    * @param  thread_count: Number of worker threads, 0 to use every hardware thread
+    * @param  sound_buffer_size: Number of samples kept per instance between steps
+    * @return None
+    */
+    NESPool(const uint32_t& instance_count, const uint32_t& thread_count = 0, const uint32_t& sound_buffer_size = NES_POOL_DEFAULT_SOUND_BUFFER_SIZE);
+
+    // Destructor, stops the worker threads
+    ~NESPool();
+
+    NESPool(const NESPool&) = delete;
+    NESPool& operator=(const NESPool&) = delete;
+
+    /**
+    * @brief  Loads the same cartridge into every instance, the file is only read once
+    * @param  path: The file path to the cartridge
+    * @return True if the file is read, false otherwise
+    */
+    bool loadCartridge(const std::string& path);
+
+    /**
+    * @brief  Runs frames on every instance in parallel, returns once all of them are done
+    *   The sound buffers are cleared first, and hold the samples of these frames afterwards
+    * @param  frames: Number of frames to run on each instance
+    * @return None
+    */
+    void stepFrames(const uint32_t& frames);
+
+    /**
+    * @brief  Gets the number of instances
+    * @param  None
+    * @return Number of instances
+    */
+    uint32_t getInstanceCount() const;
+
+    /**
+    * @brief  Gets the number of worker threads
+    * @param  None
+    * @return Number of worker threads
+    */
+    uint32_t getThreadCount() const;
+
+    /**
+    * @brief  Gets an instance, must not be used while stepFrames is running
+    * @param  index: The index of the instance
+    * @return The NES system of the instance
+    */
+    NES& getNES(const uint32_t& index);
+
+    /**
+    * @brief  Gets the controller connected to an instance
+    * @param  index: The index of the instance
+    * @return The controller of the instance
+    */
+    Controller& getController(const uint32_t& index);
+
+    /**
+    * @brief  Gets the frame buffer of an instance, holding its last frame
+    * @param  index: The index of the instance
+    * @return The frame buffer, see NESWindow::getFrameBuffer
+    */
+    const uint16_t* getFrameBuffer(const uint32_t& index) const;
+
+    /**
+    * @brief  Gets the sound buffer of an instance
+    * @param  index: The index of the instance
+    * @return The sound buffer, holding the samples of the last step
+    */
+    const NESSoundBuffer& getSoundBuffer(const uint32_t& index) const;
+
+private:
+    struct Instance {
+        explicit Instance(const uint32_t& sound_buffer_size);
+        NES nes;
+        NESWindowNull window;
+        NESSoundBuffer sound;
+        Controller controller;
+    };
+
+    // Range of instances owned by a worker, aligned so workers don't share cache lines
+    struct alignas(64) WorkRange {
+        std::atomic<uint32_t> next_index;
+        uint32_t end_index;
+    };
+
+    std::vector<std::unique_ptr<Instance>> instances_;
+    uint32_t worker_count_;
+    std::unique_ptr<WorkRange[]> work_ranges_;
+    std::vector<std::thread> workers_;
+
+    // Worker synchronization, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable work_done_;
+    uint64_t step_generation_;
+    uint32_t frames_to_step_;
+    uint32_t busy_worker_count_;
+    bool is_stopping_;
+
+    /**
+    * @brief  Main loop of a worker thread
+    * @param  worker_index: The index of the worker
+    * @return None
+    */
+    void runWorker(const uint32_t& worker_index);
+
+    /**
+    * @brief  Claims the next instance of a work range
+    * @param  range: The work range to claim from
+    * @param  index: Set to the index of the claimed instance
+    * @return True if an instance is claimed, false if the range is done
+    */
+    static bool claimInstance(WorkRange& range, uint32_t& index);
+
+    /**
+    * @brief  Pins the calling thread to the next core of the ones the process is allowed to run on
+    *   Each call takes the next core, so the workers of every pool in the process are spread over the cores
+    * @param  None
+    * @return True if pinned, false if the cores can't be read or set, or on platforms without thread affinity
+    */
+    static bool pinThreadToCore();
+};
+
+#endif
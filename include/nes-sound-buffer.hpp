@@ -0,0 +1,49 @@
+#ifndef _NES_SOUND_BUFFER_HPP_
+#define _NES_SOUND_BUFFER_HPP_
+// Standard Library Headers
+#include <cstdint>
+#include <memory>
+// Base Class
+#include "nes-sound.hpp"
+
+// Sound system that keeps the samples in a preallocated buffer for the caller to read, samples past its capacity are dropped
+class NESSoundBuffer : public NESSound {
+public:
+    /**
+    * @brief  Constructor for NESSoundBuffer
+    * @param  capacity: Maximum number of samples kept until the buffer is cleared
+    * @return None
+    */
+    explicit NESSoundBuffer(const uint32_t& capacity);
+
+    void queueSample(const float& sample) override;
+    void play() override;
+
+    /**
+    * @brief  Gets the samples queued since the buffer was last cleared
+    * @param  None
+    * @return The samples
+    */
+    const float* getSamples() const;
+
+    /**
+    * @brief  Gets the number of samples queued since the buffer was last cleared
+    * @param  None
+    * @return Number of samples, at most the capacity
+    */
+    uint32_t getSampleCount() const;
+
+    /**
+    * @brief  Removes every sample from the buffer
+    * @param  None
+    * @return None
+    */
+    void clear();
+
+private:
+    const uint32_t capacity_;
+    std::unique_ptr<float[]> samples_;
+    uint32_t sample_count_;
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef _NES_SOUND_NULL_HPP_
+#define _NES_SOUND_NULL_HPP_
+// Base Class
+#include "nes-sound.hpp"
+
+// Sound system that discards every sample, used when running without an audio device
+class NESSoundNull : public NESSound {
+public:
+    void queueSample(const float& sample) override;
+    void play() override;
+};
+
+#endif
@@ -9,21 +9,56 @@
 #include <SFML/Audio.hpp>
 // Project Headers
 #include "nes-sound-stream-sfml.hpp"
+#include "rate-control-resampler.hpp"
 // Project Defines
 #define NES_SOUND_SFML_SAMPLE_BUFFER_SIZE 1024
+// Audio latency held by the stream queue, in milliseconds
+#define NES_SOUND_SFML_DEFAULT_LATENCY 45
+#define NES_SOUND_SFML_MIN_LATENCY 30
+#define NES_SOUND_SFML_MAX_LATENCY 60
 
 class NESSoundSFML : public NESSound {
 public:
-    NESSoundSFML(const uint32_t& sample_buffer_size = NES_SOUND_SFML_SAMPLE_BUFFER_SIZE);
+    /**
+    * @brief  Constructor for NESSoundSFML
+    * @param  sample_buffer_size: Number of samples collected before they are queued to the stream
+    * @param  latency: Audio latency to keep queued, in milliseconds from NES_SOUND_SFML_MIN_LATENCY to NES_SOUND_SFML_MAX_LATENCY
+    * @return None
+    */
+    NESSoundSFML(const uint32_t& sample_buffer_size = NES_SOUND_SFML_SAMPLE_BUFFER_SIZE, const uint32_t& latency = NES_SOUND_SFML_DEFAULT_LATENCY);
 
     void queueSample(const float& sample) override;
     void play() override;
 
+    /**
+    * @brief  Gets the number of samples queued to the audio stream that haven't been played yet
+    * @param  None
+    * @return Number of queued samples
+    */
+    uint32_t getQueuedSampleCount() const;
+
+    /**
+    * @brief  Gets the maximum number of samples that can be queued to the audio stream
+    * @param  None
+    * @return Number of samples
+    */
+    uint32_t getQueueCapacity() const;
+
 private:
     uint32_t sample_count_;
     const uint32_t sample_buffer_size_;
     std::unique_ptr<int16_t[]> sample_buffer_;
+    // Number of queued samples the resampler steers towards
+    const uint32_t target_queued_sample_count_;
+    RateControlResampler resampler_;
     NESSoundStreamSFML sound_stream_;
+
+    /**
+    * @brief  Queues the collected samples to the stream
+    * @param  None
+    * @return None
+    */
+    void flushSamples();
 };
 
 #endif
@@ -3,20 +3,50 @@
 // Base Class
 #include <SFML/Audio.hpp>
 // Standard Library Headers
+#include <cstdint>
 #include <memory>
-#include <queue>
+// Project Headers
+#include "sample-ring-buffer.hpp"
+// Project Defines
+// About 185 ms of samples at 44100 Hz
+#define NES_SOUND_STREAM_SFML_RING_SIZE 8192
 
 class NESSoundStreamSFML : public sf::SoundStream {
 public:
-    NESSoundStreamSFML();
+    NESSoundStreamSFML(const uint32_t& ring_size = NES_SOUND_STREAM_SFML_RING_SIZE);
+
+    /**
+    * @brief  Queues samples for the audio thread, only called from the emulation thread
+    *   Samples that don't fit in the ring are dropped
+    * @param  sample_buffer: The samples to queue
+    * @param  sample_count: Number of samples to queue
+    * @return None
+    */
     void queueSampleChunk(const int16_t* const& sample_buffer, const size_t& sample_count);
+
+    /**
+    * @brief  Gets the number of queued samples that the audio thread hasn't streamed yet
+    * @param  None
+    * @return Number of queued samples
+    */
+    uint32_t getQueuedSampleCount() const;
+
+    /**
+    * @brief  Gets the maximum number of samples that can be queued
+    * @param  None
+    * @return Number of samples
+    */
+    uint32_t getQueueCapacity() const;
+
 private:
     bool onGetData(Chunk& data) override;
     void onSeek(sf::Time timeOffset) override;
-    // For managing audio streaming
-    std::queue<std::unique_ptr<int16_t[]>> m_chunkQueue;
-    // For seeking
-    std::size_t                         m_currentSample;
+    // Samples shared between the emulation thread and the audio thread
+    SampleRingBuffer sample_ring_;
+    // Samples handed to SFML, which reads them until the next call to onGetData
+    std::unique_ptr<int16_t[]> chunk_buffer_;
+    // Last sample streamed, held while the ring is empty
+    int16_t last_sample_;
 };
 
 #endif
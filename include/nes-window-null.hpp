@@ -0,0 +1,12 @@
+#ifndef _NES_WINDOW_NULL_HPP_
+#define _NES_WINDOW_NULL_HPP_
+// Project Headers
+#include "nes-window.hpp"
+
+// Display window that never displays the frame buffer, used when running without a GPU
+class NESWindowNull : public NESWindow {
+public:
+    void render() override;
+};
+
+#endif
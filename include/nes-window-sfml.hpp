@@ -14,7 +14,7 @@ class NESWindowSFML : public NESWindow {
 public:
     NESWindowSFML(const uint16_t& frame_rate_limit = NES_WINDOW_FPS, const uint16_t& window_width = NES_WINDOW_SFML_WIDTH, const uint16_t& window_height = NES_WINDOW_SFML_HEIGHT, const std::string& window_title = NES_WINDOW_TITLE);
     ~NESWindowSFML() override;
-    void setPixel(const uint16_t& x, const uint16_t& y, const Colour& colour) override;
+    void onFrameComplete() override;
     void render() override;
     sf::RenderWindow& getWindow();
 private:
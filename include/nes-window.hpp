@@ -1,11 +1,17 @@
 #ifndef _NES_WINDOW_HPP_
 #define _NES_WINDOW_HPP_
 // Standard Library Headers
+#include <array>
 #include <cstdint>
+#include <memory>
 // Project Defines
 #define NES_WINDOW_FPS     60
 #define NES_WINDOW_WIDTH  256
 #define NES_WINDOW_HEIGHT 240
+#define NES_WINDOW_PALETTE_SIZE 0x40
+// Pixels hold a system palette index in the low bits and the colour emphasis bits above it
+#define NES_WINDOW_PIXEL_PALETTE_INDEX_MASK 0x003F
+#define NES_WINDOW_PIXEL_EMPHASIS_SHIFT 6
 
 class NESWindow {
 public:
@@ -15,19 +21,37 @@ public:
         uint8_t b;
     };
 
+    // Colours of the NES system palette
+    static const std::array<Colour, NES_WINDOW_PALETTE_SIZE> system_palette;
+
+    // Constructor
+    NESWindow();
+
     // Destructor
     virtual ~NESWindow() = default;
-    
+
+    /**
+    * @brief  Gets the frame buffer that the PPU renders into
+    *   Pixels are stored row by row from the top-left corner, NES_WINDOW_WIDTH pixels per row
+    *   Each pixel is a system palette index, with the colour emphasis bits from NES_WINDOW_PIXEL_EMPHASIS_SHIFT
+    * @param  None
+    * @return The frame buffer
+    */
+    uint16_t* getFrameBuffer() const;
+
     /**
-    * @brief  Sets the pixel at the given x and y coordinate
-    * @param  x: The x coordinate of the pixel
-    * @param  y: The y coordinate of the pixel
-    * @param  r: The red value of the pixel
-    * @param  g: The green value of the pixel
-    * @param  b: The blue value of the pixel
+    * @brief  Called when a scanline of the frame buffer is completely rendered
+    * @param  y: The y coordinate of the scanline
     * @return None
     */
-    virtual void setPixel(const uint16_t& x, const uint16_t& y, const Colour& colour) = 0;
+    virtual void onScanline(const uint16_t& y);
+
+    /**
+    * @brief  Called when every scanline of the frame buffer is completely rendered
+    * @param  None
+    * @return None
+    */
+    virtual void onFrameComplete();
 
     /**
     * @brief  Renders the pixel buffer to the display window
@@ -35,6 +59,49 @@ public:
     * @return None
     */
     virtual void render() = 0;
+
+protected:
+    std::unique_ptr<uint16_t[]> frame_buffer_;
+
+    /**
+    * @brief  Converts a scanline of the frame buffer to RGBA colours
+    * @param  y: The y coordinate of the scanline
+    * @param  rgba_buffer: Buffer of NES_WINDOW_WIDTH * 4 bytes to write to
+    * @return None
+    */
+    void convertScanlineToRGBA(const uint16_t& y, uint8_t* rgba_buffer) const;
+
+    /**
+    * @brief  Converts the frame buffer to RGBA colours
+    * @param  rgba_buffer: Buffer of NES_WINDOW_WIDTH * NES_WINDOW_HEIGHT * 4 bytes to write to
+    * @return None
+    */
+    void convertFrameToRGBA(uint8_t* rgba_buffer) const;
+
+private:
+    /**
+    * @brief  Converts pixels to RGBA colours through the system palette
+    *   Uses AVX2 or SSSE3 when the host supports them, checked on the first call
+    *   The colour emphasis bits of the pixels are ignored, only the palette index is converted
+    * @param  pixels: The pixels to convert
+    * @param  pixel_count: Number of pixels to convert
+    * @param  rgba_buffer: Buffer of pixel_count * 4 bytes to write to
+    * @return None
+    */
+    static void convertToRGBA(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer);
+
+    using ConvertFunction = void (*)(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer);
+
+    // Conversions chosen by convertToRGBA, the SIMD ones convert the pixels left over with the scalar one
+    static void convertToRGBAScalar(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer);
+
+#if defined(__x86_64__) || defined(__i386__)
+    // 8 pixels at a time, gathering their colours from the packed palette
+    static void convertToRGBAAVX2(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer);
+
+    // 16 pixels at a time, looking up each channel with byte shuffles
+    static void convertToRGBASSSE3(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer);
+#endif
 };
 
 #endif
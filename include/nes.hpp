@@ -1,5 +1,7 @@
 #ifndef _NES_HPP_
 #define _NES_HPP_
+// Standard Library Headers
+#include <vector>
 // Project Headers
 #include "nes-window.hpp"
 #include "nes-sound.hpp"
@@ -10,6 +12,8 @@
 #include "ppu-bus.hpp"
 #include "controller.hpp"
 #include "memory-unit.hpp"
+#include "scheduler.hpp"
+#include "perf-counters.hpp"
 
 class NES {
 public:
@@ -41,6 +45,13 @@ public:
     */
     void loadCartridge(const std::string& path);
 
+    /**
+    * @brief  Loads the cartridge from the data stream of the ROM
+    * @param  rom_data_stream: The data stream of the ROM
+    * @return None
+    */
+    void loadCartridge(std::istream& rom_data_stream);
+
     /**
     * @brief  Releases the cartridge from the NES system
     * @param  None
@@ -63,11 +74,45 @@ public:
     void clock();
 
     /**
-    * @brief  Runs 1 frame update of the NES system
+    * @brief  Runs 1 frame update of the NES system, until the PPU completes the frame
+    *   With run-ahead enabled, the frames ahead are displayed instead of this frame
     * @param  None
+    * @return Number of master clocks the frame ran for
+    */
+    uint32_t stepFrame();
+
+    /**
+    * @brief  Sets the number of frames to run ahead, to hide the input lag of the emulated game
+    *   After each frame, the state is saved and the frames ahead are run with the same input
+    *   The last of them is displayed, then the state is restored. Only the audio of the frame itself is output
+    * @param  frames: Number of frames to run ahead, 0 to disable run-ahead
+    * @return None
+    */
+    void setRunAheadFrames(const uint8_t& frames);
+
+    /**
+    * @brief  Enables or disables catch-up scheduling
+    *   When enabled, the CPU runs freely until the next scheduled event, and the PPU and the APU are only
+    *   caught up when their state is observed or when one of their events is due
+    * @param  value: True to use catch-up scheduling, false to interleave the PPU and the CPU every clock
+    * @return None
+    */
+    void setCatchUpSchedulingEnabled(const bool& value);
+
+    /**
+    * @brief  Enables or disables instruction stepping
+    *   When enabled, the CPU runs 1 instruction at a time and the PPU is caught up by the cycles it took
+    * @param  value: True to step the CPU by instructions, false to step it by cycles
     * @return None
     */
-    void stepFrame();
+    void setInstructionSteppingEnabled(const bool& value);
+
+    /**
+    * @brief  Enables or disables the scanline-batched PPU renderer
+    * @param  value: True to render visible scanlines in batches, false to render every PPU dot as it is clocked
+    * @return None
+    */
+    void setScanlineRendererEnabled(const bool& value);
 
     /**
     * @brief  Connects the controller to the NES system
@@ -76,8 +121,66 @@ public:
     */
     void connectController(Controller& controller);
 
+    /**
+    * @brief  Gets the size of the buffer needed to save the state of the NES system
+    *   The size only changes when a different cartridge is loaded
+    * @param  None
+    * @return Size of the state in bytes
+    */
+    uint32_t getSaveStateSize() const;
+
+    /**
+    * @brief  Saves the state of the whole NES system into a buffer, without allocating memory
+    *   The display window, sound system and scheduling settings are not part of the state
+    *   Neither is the frame buffer, so states saved between frames restore the exact output
+    * @param  buffer: The buffer to save the state to
+    * @param  buffer_size: The size of the buffer, at least getSaveStateSize() bytes
+    * @return True if successfully saved, false if the buffer is too small
+    */
+    bool saveState(uint8_t* buffer, const uint32_t& buffer_size) const;
+
+    /**
+    * @brief  Loads the state of the whole NES system from a buffer written by saveState
+    *   The state must come from the same cartridge, nothing is loaded if its header doesn't match
+    * @param  buffer: The buffer to load the state from
+    * @param  buffer_size: The size of the buffer
+    * @return True if successfully loaded, false otherwise
+    */
+    bool loadState(const uint8_t* buffer, const uint32_t& buffer_size);
+
+    /**
+    * @brief  Gets the time spent in each subsystem and the CPU bus accesses, of the last frame and in total
+    *   Only recorded when built with -DNES_PERF_COUNTERS, every counter stays 0 otherwise
+    *   Time in NES::clock and the main loop outside of the CPU, PPU and APU is charged to SYSTEM
+    * @param  None
+    * @return Copy of the counters
+    */
+    PerfCounters::Snapshot getPerfCounters() const;
+
+    /**
+    * @brief  Sets the stream the counters of every frame are written to as CSV, with a header row written right away
+    *   Frames run ahead are recorded like the others
+    * @param  stream: The stream to write to, nullptr to stop writing
+    * @return None
+    */
+    void setPerfCountersDumpStream(std::ostream* stream);
+
 private:
+    // Written at the start of every saved state
+    struct SaveStateHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t size;
+    };
+
     uint64_t clock_count_;
+    bool is_catch_up_scheduling_enabled_;
+    bool is_instruction_stepping_enabled_;
+    uint8_t run_ahead_frames_;
+    // State restored after running ahead, sized when run-ahead first runs with a cartridge
+    std::vector<uint8_t> run_ahead_state_;
+    NESWindow* window_;
+    NESSound* sound_system_;
     RP2A03 cpu_;
     MemoryUnit ram_;
     RP2C02 ppu_;
@@ -86,6 +189,46 @@ private:
     std::unique_ptr<Cartridge> cartridge_;
     CPUBUS cpu_bus_;
     PPUBUS ppu_bus_;
+    // Events the CPU runs freely until, when catch-up scheduling is used
+    Scheduler scheduler_;
+    PerfCounters perf_counters_;
+    // Size of a saved state, computed whenever the cartridge changes as nothing else changes it
+    uint32_t save_state_size_;
+
+    /**
+    * @brief  Computes the size of a saved state by saving the whole NES system without a buffer
+    * @param  None
+    * @return Size of the state in bytes
+    */
+    uint32_t computeSaveStateSize() const;
+
+    /**
+    * @brief  Saves the state of every component of the NES system, after the header
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveComponentStates(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Runs the NES system with the selected scheduling until the PPU sets its frame complete flag
+    * @param  None
+    * @return Number of master clocks ran
+    */
+    uint32_t runFrame();
+
+    /**
+    * @brief  Schedules the next event of the PPU and of the APU, from their current state
+    * @param  None
+    * @return None
+    */
+    void scheduleEvents();
+
+    /**
+    * @brief  Catches up the component of a due event, and schedules its next one
+    * @param  event: The due event
+    * @return None
+    */
+    void handleEvent(const Scheduler::Event& event);
 
     // Friending classes for access to private members
     friend class NESDebugWindow;
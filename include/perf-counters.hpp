@@ -0,0 +1,233 @@
+#ifndef _PERF_COUNTERS_HPP_
+#define _PERF_COUNTERS_HPP_
+// Standard Library Headers
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+// Project Defines
+// The counters are only recorded when built with -DNES_PERF_COUNTERS, otherwise the macros compile to nothing
+#ifdef NES_PERF_COUNTERS
+// Records a frame from here to the end of the enclosing scope, the counters may be null
+#define NES_PERF_FRAME(perf_counters) const PerfCounters::FrameScope nes_perf_frame_(perf_counters)
+// Charges the time until the end of the enclosing scope to a subsystem, the counters may be null
+#define NES_PERF_SCOPE(perf_counters, subsystem) const PerfCounters::Scope nes_perf_scope_(perf_counters, subsystem)
+// Counts an access of the CPU bus, the counters may be null
+#define NES_PERF_COUNT_BUS_ACCESS(perf_counters, address, is_write) \
+    if (perf_counters) { (perf_counters)->countBusAccess(address, is_write); }
+#else
+#define NES_PERF_FRAME(perf_counters)
+#define NES_PERF_SCOPE(perf_counters, subsystem)
+#define NES_PERF_COUNT_BUS_ACCESS(perf_counters, address, is_write)
+#endif
+
+// Time spent in each subsystem and accesses of the CPU bus by region, per frame
+//   Time is measured in timestamp counter ticks, and each tick is charged to the innermost subsystem running,
+//   so a PPU catch-up caused by the CPU is charged to the PPU and not the CPU
+class PerfCounters {
+public:
+    enum class Subsystem : uint8_t {
+        // Main loop and scheduling, everything outside the other subsystems
+        SYSTEM = 0,
+        CPU = 1,
+        PPU = 2,
+        APU = 3,
+        COUNT = 4,
+    };
+
+    enum class BusRegion : uint8_t {
+        // $0000-$1FFF
+        RAM = 0,
+        // $2000-$3FFF
+        PPU_REGISTERS = 1,
+        // $4000-$401F, APU and I/O registers
+        APU_IO = 2,
+        // $4020-$FFFF
+        CARTRIDGE = 3,
+        COUNT = 4,
+    };
+
+    struct Counters {
+        std::array<uint64_t, static_cast<uint8_t>(Subsystem::COUNT)> subsystem_ticks;
+        std::array<uint64_t, static_cast<uint8_t>(BusRegion::COUNT)> bus_reads;
+        std::array<uint64_t, static_cast<uint8_t>(BusRegion::COUNT)> bus_writes;
+    };
+
+    struct Snapshot {
+        uint64_t frame_count;
+        // Counters of the last complete frame, and of every frame since the counters were reset
+        Counters last_frame;
+        Counters total;
+    };
+
+    // Charges the time of its lifetime to a subsystem, then goes back to the subsystem running before it
+    //   Nothing is timed if the subsystem is already running, so the cycles run by a batched subsystem cost no timestamps
+    class Scope {
+    public:
+        Scope(PerfCounters* perf_counters, const Subsystem& subsystem);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        PerfCounters* perf_counters_;
+        Subsystem previous_subsystem_;
+    };
+
+    // Begins a frame, and ends it at the end of its lifetime
+    class FrameScope {
+    public:
+        explicit FrameScope(PerfCounters* perf_counters);
+        ~FrameScope();
+        FrameScope(const FrameScope&) = delete;
+        FrameScope& operator=(const FrameScope&) = delete;
+    private:
+        PerfCounters* perf_counters_;
+    };
+
+    // Constructor, every counter starts at 0
+    PerfCounters();
+
+    /**
+    * @brief  Starts a frame, the time until the first subsystem runs is charged to SYSTEM
+    *   Anything recorded since the end of the last frame is dropped
+    * @param  None
+    * @return None
+    */
+    void beginFrame();
+
+    /**
+    * @brief  Ends the frame, its counters become the last frame's and are added to the totals
+    *   A row is written to the dump stream, if one is set
+    * @param  None
+    * @return None
+    */
+    void endFrame();
+
+    /**
+    * @brief  Sets every counter and the frame count back to 0
+    * @param  None
+    * @return None
+    */
+    void reset();
+
+    /**
+    * @brief  Gets a copy of the counters
+    * @param  None
+    * @return The counters of the last frame and the totals
+    */
+    Snapshot getSnapshot() const;
+
+    /**
+    * @brief  Sets the stream a CSV row is written to at the end of every frame, the header is written right away
+    * @param  stream: The stream to write to, nullptr to stop writing
+    * @return None
+    */
+    void setDumpStream(std::ostream* stream);
+
+    /**
+    * @brief  Makes a subsystem the one the time is charged to, charging the time since the last change to the previous one
+    * @param  subsystem: The subsystem starting to run
+    * @return The subsystem that was running
+    */
+    Subsystem switchSubsystem(const Subsystem& subsystem);
+
+    /**
+    * @brief  Counts an access of the CPU bus
+    * @param  address: The address accessed
+    * @param  is_write: True for a write, false for a read
+    * @return None
+    */
+    void countBusAccess(const uint16_t& address, const bool& is_write);
+
+    /**
+    * @brief  Reads the timestamp counter of the host, or a nanosecond clock where there is none
+    * @param  None
+    * @return Number of ticks
+    */
+    static uint64_t readTimestamp();
+
+private:
+    uint64_t frame_count_;
+    Counters frame_;
+    Counters last_frame_;
+    Counters total_;
+    Subsystem current_subsystem_;
+    uint64_t last_timestamp_;
+    std::ostream* dump_stream_;
+
+    /**
+    * @brief  Writes the counters of the last frame as a CSV row
+    * @param  stream: The stream to write to
+    * @return None
+    */
+    void writeDumpRow(std::ostream& stream) const;
+};
+
+// Called for every cycle of every subsystem when enabled, so these are defined here to be inlined
+
+inline PerfCounters::Scope::Scope(PerfCounters* perf_counters, const Subsystem& subsystem):
+    perf_counters_(perf_counters), previous_subsystem_(Subsystem::SYSTEM) {
+    if (perf_counters_ && (perf_counters_->current_subsystem_ == subsystem)) {
+        perf_counters_ = nullptr;
+    }
+    if (perf_counters_) {
+        previous_subsystem_ = perf_counters_->switchSubsystem(subsystem);
+    }
+}
+
+inline PerfCounters::Scope::~Scope() {
+    if (perf_counters_) {
+        perf_counters_->switchSubsystem(previous_subsystem_);
+    }
+}
+
+inline PerfCounters::FrameScope::FrameScope(PerfCounters* perf_counters): perf_counters_(perf_counters) {
+    if (perf_counters_) {
+        perf_counters_->beginFrame();
+    }
+}
+
+inline PerfCounters::FrameScope::~FrameScope() {
+    if (perf_counters_) {
+        perf_counters_->endFrame();
+    }
+}
+
+inline PerfCounters::Subsystem PerfCounters::switchSubsystem(const Subsystem& subsystem) {
+    const uint64_t timestamp = readTimestamp();
+    frame_.subsystem_ticks[static_cast<uint8_t>(current_subsystem_)] += timestamp - last_timestamp_;
+    last_timestamp_ = timestamp;
+
+    const Subsystem previous_subsystem = current_subsystem_;
+    current_subsystem_ = subsystem;
+    return previous_subsystem;
+}
+
+inline void PerfCounters::countBusAccess(const uint16_t& address, const bool& is_write) {
+    const BusRegion region = (address < 0x2000) ? BusRegion::RAM :
+        (address < 0x4000) ? BusRegion::PPU_REGISTERS :
+        (address < 0x4020) ? BusRegion::APU_IO : BusRegion::CARTRIDGE;
+    if (is_write) {
+        frame_.bus_writes[static_cast<uint8_t>(region)]++;
+    }
+    else {
+        frame_.bus_reads[static_cast<uint8_t>(region)]++;
+    }
+}
+
+inline uint64_t PerfCounters::readTimestamp() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t timestamp;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(timestamp));
+    return timestamp;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+#endif
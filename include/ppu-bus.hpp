@@ -34,10 +34,25 @@ public:
     */
     bool writeBusData(const uint16_t& address, const uint8_t& data) override;
 
+    /**
+    * @brief  Maps the pattern tables and the mirrored name tables into the memory pages
+    *   Must be called when a cartridge is loaded or released, and when the mirroring or the CHR banks change
+    * @param  None
+    * @return None
+    */
+    void mapMemoryPages();
+
 private:
     RP2C02& ppu_;
     MemoryUnit& vram_;
     const std::unique_ptr<Cartridge>& cartridge_;
+
+    // Pointers to the 1KB pages mapped from 0x0000 to 0x3FFF, shared with the PPU
+    std::array<const uint8_t*, RP2C02_MEMORY_PAGE_COUNT> memory_pages_;
+    // Writable pointers to the 4 addressing name tables, mirrored from 0x2000 to 0x3EFF
+    std::array<uint8_t*, 4> name_table_pages_;
+    // Pattern table page read when the cartridge is not loaded
+    MemoryUnit empty_pattern_table_page_;
 };
 
 #endif
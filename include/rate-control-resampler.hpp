@@ -0,0 +1,68 @@
+#ifndef _RATE_CONTROL_RESAMPLER_HPP_
+#define _RATE_CONTROL_RESAMPLER_HPP_
+// Standard Library Headers
+#include <cstdint>
+// Project Defines
+// Largest change of the output rate, 0.5% covers the NES frame rate of 60.0988 Hz against a 60 Hz display
+#define RATE_CONTROL_RESAMPLER_MAX_DEVIATION 0.005f
+// Fraction of the distance from the target fill level accumulated on every ratio update
+#define RATE_CONTROL_RESAMPLER_ACCUMULATION_RATE 0.01
+// Largest number of output samples produced for one input sample
+#define RATE_CONTROL_RESAMPLER_MAX_OUTPUT_SAMPLES 2
+
+// Resamples a stream of samples by a ratio that follows the fill level of the audio queue
+//   The queue is kept close to a target fill level, so audio playback stays locked to the emulation speed
+//   without running dry or overflowing
+class RateControlResampler {
+public:
+    /**
+    * @brief  Constructor for RateControlResampler, the ratio starts at 1
+    * @param  max_deviation: Largest change of the resampling ratio away from 1
+    * @return None
+    */
+    explicit RateControlResampler(const float& max_deviation = RATE_CONTROL_RESAMPLER_MAX_DEVIATION);
+
+    /**
+    * @brief  Adjusts the resampling ratio from the fill level of the audio queue
+    *   An emptier queue than the target produces more samples, a fuller queue produces fewer
+    * @param  fill_level: Number of samples waiting in the audio queue
+    * @param  target_fill_level: Number of samples the audio queue should hold
+    * @return None
+    */
+    void updateRatio(const uint32_t& fill_level, const uint32_t& target_fill_level);
+
+    /**
+    * @brief  Resamples the next input sample by linear interpolation against the previous input sample
+    * @param  sample: The next input sample
+    * @param  output: Buffer of RATE_CONTROL_RESAMPLER_MAX_OUTPUT_SAMPLES samples to write to
+    * @return Number of samples written to the output
+    */
+    uint32_t resample(const float& sample, float* output);
+
+    /**
+    * @brief  Gets the resampling ratio
+    * @param  None
+    * @return Number of output samples produced per input sample
+    */
+    double getRatio() const;
+
+    /**
+    * @brief  Resets the ratio to 1 and forgets the previous fill levels and input sample
+    * @param  None
+    * @return None
+    */
+    void reset();
+
+private:
+    const float max_deviation_;
+    double ratio_;
+    // Distance between output samples, in input samples
+    double step_;
+    // Sum of the past distances from the target fill level
+    double accumulated_distance_;
+    // Position of the next output sample after the previous input sample
+    double position_;
+    float previous_sample_;
+};
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef _REWIND_BUFFER_HPP_
+#define _REWIND_BUFFER_HPP_
+// Standard Library Headers
+#include <cstdint>
+#include <vector>
+// Project Headers
+#include "nes.hpp"
+
+// Keeps the most recent states of the NES system in a fixed amount of memory, so the emulation can be stepped backwards
+//   Every state is stored as the run-length encoded XOR difference against the latest keyframe state
+//   Keyframes are encoded against zeros, and are evicted together with the states depending on them
+class RewindBuffer {
+public:
+    /**
+    * @brief  Constructor for RewindBuffer, all the memory of the buffer is allocated here
+    * @param  frame_capacity: Maximum number of states kept
+    * @param  keyframe_interval: Number of states between keyframes
+    * @param  byte_capacity: Size in bytes of the memory storing the encoded states
+    * @return None
+    */
+    RewindBuffer(const uint32_t& frame_capacity, const uint32_t& keyframe_interval, const uint32_t& byte_capacity);
+
+    /**
+    * @brief  Saves the current state of the NES system as the most recent state, evicting the oldest states when full
+    *   The buffer is cleared when the size of the state changes, such as when a different cartridge is loaded
+    * @param  nes: The NES system to save
+    * @return True if the state is stored, false if it doesn't fit in the buffer
+    */
+    bool pushState(const NES& nes);
+
+    /**
+    * @brief  Loads the most recent state into the NES system and removes it from the buffer
+    * @param  nes: The NES system to load into
+    * @return True if a state is loaded, false if the buffer is empty
+    */
+    bool popState(NES& nes);
+
+    /**
+    * @brief  Removes every state from the buffer
+    * @param  None
+    * @return None
+    */
+    void clear();
+
+    /**
+    * @brief  Gets the number of states in the buffer
+    * @param  None
+    * @return Number of states that can be popped
+    */
+    uint32_t getFrameCount() const;
+
+    /**
+    * @brief  Gets the number of bytes used by the encoded states
+    * @param  None
+    * @return Number of bytes used
+    */
+    uint32_t getUsedBytes() const;
+
+private:
+    // Location of an encoded state in the byte ring
+    struct Entry {
+        uint32_t offset;
+        uint32_t size;
+        bool is_keyframe;
+    };
+
+    const uint32_t keyframe_interval_;
+    
+    // Encoded states, stored back to back and wrapping to the start of the memory
+    std::vector<uint8_t> memory_;
+    uint32_t write_offset_;
+    uint32_t used_bytes_;
+
+    // Entries ordered from the oldest to the most recent state
+    std::vector<Entry> entries_;
+    uint32_t oldest_entry_;
+    uint32_t entry_count_;
+    // Number of states pushed since the keyframe of the most recent state
+    uint32_t states_since_keyframe_;
+
+    // Decoded keyframe of the most recent state, used as the reference of the differences
+    std::vector<uint8_t> keyframe_state_;
+    // Scratch buffers for the saved state and its encoding
+    std::vector<uint8_t> state_;
+    std::vector<uint8_t> encoded_state_;
+
+    /**
+    * @brief  Run-length encodes the XOR difference of the state against a reference into encoded_state_
+    * @param  reference: The reference state, or nullptr to encode the state itself
+    * @return Size of the encoded state in bytes
+    */
+    uint32_t encodeState(const uint8_t* reference);
+
+    /**
+    * @brief  Decodes an encoded state into a buffer holding its reference state
+    * @param  entry: The entry of the encoded state
+    * @param  state: Holds the reference state, or zeros for keyframes, overwritten with the decoded state
+    * @return None
+    */
+    void decodeState(const Entry& entry, uint8_t* state) const;
+
+    /**
+    * @brief  Finds where an encoded state fits, evicting the oldest states that are in the way
+    * @param  size: Size of the encoded state in bytes
+    * @return The offset to store the encoded state at
+    */
+    uint32_t allocateEntry(const uint32_t& size);
+
+    /**
+    * @brief  Evicts the oldest state, along with the states depending on it if it is a keyframe
+    * @param  None
+    * @return None
+    */
+    void evictOldestKeyframe();
+
+    /**
+    * @brief  Gets the entry of the state at an age
+    * @param  index: Index of the state, 0 being the oldest
+    * @return The entry of the state
+    */
+    const Entry& getEntry(const uint32_t& index) const;
+};
+
+#endif
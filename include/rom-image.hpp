@@ -0,0 +1,106 @@
+#ifndef _ROM_IMAGE_HPP_
+#define _ROM_IMAGE_HPP_
+// Standard Library Headers
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+// Project Headers
+#include "mapped-file.hpp"
+
+// Immutable program and pattern ROM of a cartridge
+//   Images read from a stream are cached by the CRC32 of their content, so every cartridge loaded from the same ROM shares 1 image
+//   Images of mapped files point straight into the mapping, the pages are shared by the operating system instead
+class RomImage {
+public:
+    /**
+    * @brief  Gets the image of a ROM, reusing the cached image if one with the same content is still in use
+    * @param  rom_data: The PRG ROM followed by the CHR ROM, kept by the image if it isn't cached yet
+    * @param  prg_rom_size: The size of the PRG ROM
+    * @param  chr_rom_size: The size of the CHR ROM, 0 if the cartridge uses CHR RAM
+    * @return A shared pointer to the image
+    */
+    static std::shared_ptr<const RomImage> getRomImage(std::unique_ptr<uint8_t[]> rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size);
+
+    /**
+    * @brief  Makes the image of a ROM inside a mapped file, without copying or reading the ROM
+    * @param  file: The mapped file, kept mapped as long as the image is in use
+    * @param  offset: The offset of the PRG ROM in the file, the CHR ROM follows it
+    * @param  prg_rom_size: The size of the PRG ROM
+    * @param  chr_rom_size: The size of the CHR ROM, 0 if the cartridge uses CHR RAM
+    * @return A shared pointer to the image, nullptr if the ROM doesn't fit in the file
+    */
+    static std::shared_ptr<const RomImage> makeMappedRomImage(std::shared_ptr<const MappedFile> file, const uint64_t& offset, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size);
+
+    /**
+    * @brief  Computes the CRC32 (IEEE 802.3) of a block of data
+    * @param  data: The data to compute the CRC32 of
+    * @param  size: The size of the data in bytes
+    * @return The CRC32 of the data
+    */
+    static uint32_t computeCRC32(const uint8_t* data, const uint32_t& size);
+
+    /**
+    * @brief  Gets the PRG ROM of the image
+    * @param  None
+    * @return Pointer to the PRG ROM
+    */
+    const uint8_t* getPrgRom() const;
+
+    /**
+    * @brief  Gets the size of the PRG ROM
+    * @param  None
+    * @return The size of the PRG ROM in bytes
+    */
+    uint32_t getPrgRomSize() const;
+
+    /**
+    * @brief  Gets the CHR ROM of the image
+    * @param  None
+    * @return Pointer to the CHR ROM
+    */
+    const uint8_t* getChrRom() const;
+
+    /**
+    * @brief  Gets the size of the CHR ROM
+    * @param  None
+    * @return The size of the CHR ROM in bytes, 0 if the cartridge uses CHR RAM
+    */
+    uint32_t getChrRomSize() const;
+
+    /**
+    * @brief  Gets the CRC32 of the image content
+    *   Computed on first use for images of mapped files, as it reads the whole ROM
+    * @param  None
+    * @return The CRC32 of the PRG ROM followed by the CHR ROM
+    */
+    uint32_t getCRC32() const;
+
+private:
+    // Keeps the memory of the ROM alive, either a heap buffer or a mapped file
+    std::shared_ptr<const void> rom_data_owner_;
+    // The PRG ROM followed by the CHR ROM
+    const uint8_t* rom_data_;
+    const uint32_t prg_rom_size_;
+    const uint32_t chr_rom_size_;
+    mutable std::once_flag crc32_flag_;
+    mutable uint32_t crc32_;
+
+    // Images in use, keyed by CRC32, guarded by s_cache_mutex_
+    static std::mutex s_cache_mutex_;
+    static std::unordered_map<uint32_t, std::weak_ptr<const RomImage>> s_cache_;
+
+    // Constructor
+    RomImage(std::shared_ptr<const void> rom_data_owner, const uint8_t* rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size);
+
+    /**
+    * @brief  Checks whether the image holds the same ROM
+    * @param  rom_data: The PRG ROM followed by the CHR ROM
+    * @param  prg_rom_size: The size of the PRG ROM
+    * @param  chr_rom_size: The size of the CHR ROM
+    * @return True if the content is the same, false otherwise
+    */
+    bool isSameRom(const uint8_t* rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size) const;
+};
+
+#endif
@@ -3,6 +3,9 @@
 // Project Headers
 #include "mos6502.hpp"
 #include "apu.hpp"
+// Project Defines
+// Most CPU cycles the APU can fall behind before it is caught up on its own
+#define RP2A03_MAX_APU_DEFERRED_CYCLES 8192
 
 class RP2A03 : public MOS6502 {
 public:
@@ -16,6 +19,14 @@ public:
     */
     void runCycle();
 
+    /**
+     * @brief  Runs 1 instruction of the CPU, deferring the APU for every cycle it takes
+     *   A cycle of an in-progress DMA transfer is run on its own, as it stalls the CPU
+     * @param  None
+     * @return Number of cycles ran
+    */
+    uint8_t runInstruction();
+
     /**
      * @brief  Starts a Direct Memory Access transfer
      * @param  page: The page to transfer from
@@ -23,6 +34,28 @@ public:
     */
     void startDMATransfer(const uint8_t& page);
 
+    /**
+     * @brief  Sets the region of the console for the APU timing
+     * @param  region: The region to set
+     * @return None
+    */
+    void setRegion(const APU::Region& region);
+
+    /**
+     * @brief  Runs the APU cycles deferred since it was last caught up
+     *   The APU is caught up on its own before its registers are accessed and at the end of an audio frame
+     * @param  None
+     * @return None
+    */
+    void catchUpAPU();
+
+    /**
+     * @brief  Gets the number of CPU cycles until the next APU frame sequencer step, counting the deferred cycles
+     * @param  None
+     * @return Number of CPU cycles, 0 if the step is already deferred
+    */
+    uint32_t getCyclesUntilAPUSequencerStep() const;
+
     /**
      * @brief  Reads APU register data
      * @param  address: address to read from
@@ -45,9 +78,46 @@ public:
     */
     void connectSoundSystem(NESSound& sound_system);
 
+    /**
+     * @brief  Disconnects Sound System
+     * @param  None
+     * @return None
+    */
+    void disconnectSoundSystem();
+
+    /**
+     * @brief  Connects the performance counters the CPU and APU cycles are timed to
+     * @param  perf_counters: The counters to record to, nullptr to stop recording
+     * @return None
+    */
+    void connectPerfCounters(PerfCounters* perf_counters);
+
+    /**
+     * @brief  Outputs the audio samples of the cycles ran since the last call to the Sound System
+     * @param  None
+     * @return None
+    */
+    void endAudioFrame();
+
+    /**
+     * @brief  Saves the state of the CPU and the APU
+     * @param  writer: The writer to save the state to
+     * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+     * @brief  Loads the state of the CPU and the APU
+     * @param  reader: The reader to load the state from
+     * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 private:
     // Keeping track of the CPU clock ticks
     uint64_t clock_count_;
+    // CPU cycles ran that the APU hasn't been clocked for yet
+    uint32_t apu_deferred_cycles_;
 
     // Helper Variables for DMA
     uint8_t dma_page_;
@@ -57,6 +127,7 @@ private:
     bool dma_is_synced_;
 
     APU apu_;
+    PerfCounters* perf_counters_;
 };
 
 #endif
@@ -7,6 +7,14 @@
 // Project Headers
 #include "nes-window.hpp"
 #include "bus.hpp"
+#include "save-state.hpp"
+#include "perf-counters.hpp"
+// Project Defines
+#define RP2C02_CYCLES_PER_SCANLINE 341
+#define RP2C02_SCANLINES_PER_FRAME 262
+#define RP2C02_CYCLES_PER_FRAME (RP2C02_CYCLES_PER_SCANLINE * RP2C02_SCANLINES_PER_FRAME)
+#define RP2C02_MEMORY_PAGE_SIZE 0x0400
+#define RP2C02_MEMORY_PAGE_COUNT 0x0010
 
 class RP2C02 {
 public:
@@ -107,6 +115,21 @@ public:
     */
     void connectBUS(BUS* target_bus);
 
+    /**
+    * @brief  Connects PPU to the memory pages of the pattern tables and name tables
+    *   The background and sprite fetches read through them instead of the BUS
+    * @param  memory_pages: Pointers to the 1KB pages mapped from 0x0000 to 0x3FFF
+    * @return None
+    */
+    void connectMemoryPages(const std::array<const uint8_t*, RP2C02_MEMORY_PAGE_COUNT>* memory_pages);
+
+    /**
+    * @brief  Connects the performance counters the PPU cycles are timed to
+    * @param  perf_counters: The counters to record to, nullptr to stop recording
+    * @return None
+    */
+    void connectPerfCounters(PerfCounters* perf_counters);
+
     /**
     * @brief  Run 1 cycle of the PPU
     * @param  None
@@ -114,6 +137,44 @@ public:
     */
     void runCycle();
 
+    /**
+    * @brief  Defers cycles of the PPU until its state is observed (catch-up synchronization)
+    *   The caller must catch up once the deferred cycles reach the start of VBlank, so the NMI flag is raised on time
+    * @param  cycles: Number of cycles to defer
+    * @return None
+    */
+    void deferCycles(const uint32_t& cycles);
+
+    /**
+    * @brief  Gets the number of cycles to defer or run, on top of the deferred ones, until the VBlank flag is set
+    * @param  None
+    * @return Number of cycles, including the one setting the VBlank flag
+    */
+    uint32_t getCyclesUntilVBlank() const;
+
+    /**
+    * @brief  Gets the number of cycles to defer or run, on top of the deferred ones, until the frame complete flag is set
+    * @param  None
+    * @return Number of cycles, including the one setting the flag
+    */
+    uint32_t getCyclesUntilFrameComplete() const;
+
+    /**
+    * @brief  Runs all the deferred cycles of the PPU
+    * @param  None
+    * @return None
+    */
+    void catchUp();
+
+    /**
+    * @brief  Enables or disables the scanline renderer
+    *   When enabled, the visible dots of a scanline are rendered in one batch at the end of the scanline,
+    *   falling back to the dot-accurate renderer as soon as a PPU register is accessed mid-scanline
+    * @param  value: True to enable the scanline renderer, false to render every dot as it is clocked
+    * @return None
+    */
+    void setScanlineRendererEnabled(const bool& value);
+
     /**
     * @brief  Reads data from the Palette Table at the address
     * @param  address: The address to read from
@@ -165,6 +226,20 @@ public:
     */
     void setNMIFlag(const bool& value);
 
+    /**
+    * @brief  Getter for is_frame_complete_, set when the PPU reaches the post-render scanline (scanline 240, cycle 0)
+    * @param  None
+    * @return is_frame_complete_
+    */
+    bool getFrameCompleteFlag() const;
+
+    /**
+    * @brief  Setter for is_frame_complete_
+    * @param  value: new value
+    * @return None
+    */
+    void setFrameCompleteFlag(const bool& value);
+
     /**
     * @brief  Returns whether the PPU is rendering or not
     * @param  None
@@ -246,6 +321,14 @@ public:
     */
     void shiftSpriteShifters(const uint8_t& sprite_index);
 
+    /**
+    * @brief  Gets the pixel to output for the colour of a palette
+    * @param  palette_id: The palette to use
+    * @param  pixel_colour_value: The colour index within the palette
+    * @return System palette index of the colour, with the colour emphasis bits
+    */
+    uint16_t getPixelFromPalette(const uint8_t& palette_id, const uint8_t& pixel_colour_value) const;
+
     /**
     * @brief  Gets the colour from the palette
     * @param  palette_id: The ID of the palette
@@ -277,9 +360,44 @@ public:
     */
     void searchSpritesAtScanline(const int16_t& scanline);
 
+    /**
+    * @brief  Saves the state of the PPU, including its deferred cycles
+    * @param  writer: The writer to save the state to
+    * @return None
+    */
+    void saveState(SaveStateWriter& writer) const;
+
+    /**
+    * @brief  Loads the state of the PPU
+    *   The scanline renderer setting is kept, as it is not part of the emulated state
+    * @param  reader: The reader to load the state from
+    * @return None
+    */
+    void loadState(SaveStateReader& reader);
+
 private:
-    // Colour Palette for display
-    std::array<NESWindow::Colour, 0x40> colour_palette_;
+    /**
+    * @brief  Runs the dot-accurate logic for the current scanline cycle
+    * @param  None
+    * @return None
+    */
+    void runDot();
+
+    /**
+    * @brief  Renders visible dots 1 to 256 of the current scanline in one batch
+    *   Only valid when no PPU register was accessed during those dots
+    * @param  None
+    * @return None
+    */
+    void renderScanline();
+
+    /**
+    * @brief  Runs the dots deferred by the scanline renderer, and falls back to the dot-accurate renderer for the rest of the scanline
+    * @param  None
+    * @return None
+    */
+    void syncScanline();
+
     // Palette Table (Keeps the palette table used on screen)
     std::array<uint8_t, 0x20> palette_table_;
     // OAM (Keeps the state of the sprites)
@@ -313,6 +431,8 @@ private:
     
     // PPU Emulator Variables
     bool nmi_requested_;
+    // Set once every visible scanline of the frame has been run
+    bool is_frame_complete_;
     uint64_t cycles_elapsed_;
 
     // Current Scanline
@@ -320,6 +440,16 @@ private:
     // Current Scanline Cycle
     int16_t scanline_cycle_;
 
+    // Catch-up Synchronization Variables
+    uint32_t deferred_cycles_;
+
+    // Scanline Renderer Variables
+    bool is_scanline_renderer_enabled_;
+    // Set when a register is accessed, the rest of the scanline is rendered dot by dot
+    bool is_dot_accurate_scanline_;
+    // Number of visible dots clocked but not rendered yet
+    uint16_t pending_dots_;
+
     // Next Tile ID of the background
     uint8_t bg_next_tile_id_;
     // Next Tile Attribute of the background
@@ -344,7 +474,32 @@ private:
 
     // PPU External Component Pointers
     NESWindow* window_;
+    uint16_t* frame_buffer_;
     BUS* bus_;
+    const std::array<const uint8_t*, RP2C02_MEMORY_PAGE_COUNT>* memory_pages_;
+    PerfCounters* perf_counters_;
+
+    /**
+    * @brief  Reads the pattern tables and name tables through the memory pages
+    * @param  address: The address to read from, must be below 0x3F00
+    * @return Data read
+    */
+    uint8_t readMemoryPage(const uint16_t& address) const;
+
+    /**
+    * @brief  Notifies the display window that the current scanline is completely rendered
+    * @param  None
+    * @return None
+    */
+    void completeScanline();
+
+    /**
+    * @brief  Gets the number of cycles to defer or run, on top of the deferred ones, until a cycle of the frame has run
+    * @param  scanline: Scanline of the cycle, from -1 (pre-render) to 260
+    * @param  scanline_cycle: Cycle within the scanline
+    * @return Number of cycles, including the one at the position
+    */
+    uint32_t getCyclesUntilPosition(const int16_t& scanline, const uint16_t& scanline_cycle) const;
 };
 
 #endif
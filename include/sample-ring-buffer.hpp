@@ -0,0 +1,60 @@
+#ifndef _SAMPLE_RING_BUFFER_HPP_
+#define _SAMPLE_RING_BUFFER_HPP_
+// Standard Library Headers
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Fixed capacity ring of 16 bit PCM samples, shared without locks between one writing thread and one reading thread
+//   All the memory of the ring is allocated in the constructor
+class SampleRingBuffer {
+public:
+    /**
+    * @brief  Constructor for SampleRingBuffer
+    * @param  capacity: Minimum number of samples the ring can hold, rounded up to a power of two
+    * @return None
+    */
+    explicit SampleRingBuffer(const uint32_t& capacity);
+
+    /**
+    * @brief  Appends samples to the ring, only called from the writing thread
+    *   Samples that don't fit in the ring are dropped
+    * @param  samples: The samples to append
+    * @param  sample_count: Number of samples to append
+    * @return Number of samples appended
+    */
+    uint32_t write(const int16_t* samples, const uint32_t& sample_count);
+
+    /**
+    * @brief  Removes the oldest samples from the ring, only called from the reading thread
+    * @param  samples: Buffer of sample_count samples to write to
+    * @param  sample_count: Maximum number of samples to remove
+    * @return Number of samples removed
+    */
+    uint32_t read(int16_t* samples, const uint32_t& sample_count);
+
+    /**
+    * @brief  Gets the number of samples waiting to be read, can be called from either thread
+    * @param  None
+    * @return Number of samples in the ring
+    */
+    uint32_t getFillLevel() const;
+
+    /**
+    * @brief  Gets the number of samples the ring can hold
+    * @param  None
+    * @return The capacity of the ring
+    */
+    uint32_t getCapacity() const;
+
+private:
+    const uint32_t capacity_;
+    const uint32_t index_mask_;
+    std::unique_ptr<int16_t[]> samples_;
+    // Total number of samples written and read, each index is only stored by its own thread
+    //   Aligned so the two threads don't share a cache line
+    alignas(64) std::atomic<uint32_t> write_index_;
+    alignas(64) std::atomic<uint32_t> read_index_;
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef _SAVE_STATE_HPP_
+#define _SAVE_STATE_HPP_
+// Standard Library Headers
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+// Project Defines
+#define SAVE_STATE_MAGIC 0x5453454E // "NEST" in little-endian
+// Increase whenever the layout of the saved state changes
+#define SAVE_STATE_VERSION 6
+
+// Writes the state of the emulator into a caller-provided buffer
+//   Values are copied with their in-memory layout, so a state is only loadable by a build of the same version and platform
+class SaveStateWriter {
+public:
+    /**
+    * @brief  Constructor for SaveStateWriter
+    * @param  buffer: The buffer to write to, can be nullptr to only count the size of the state
+    * @param  buffer_size: The size of the buffer in bytes
+    * @return None
+    */
+    SaveStateWriter(uint8_t* buffer, const uint32_t& buffer_size);
+
+    /**
+    * @brief  Writes a value to the buffer
+    * @param  value: The value to write
+    * @return None
+    */
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be saved");
+        writeBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    /**
+    * @brief  Writes a block of bytes to the buffer
+    *   Nothing is written once the buffer is overflowed, but the size keeps being counted
+    * @param  data: The bytes to write
+    * @param  size: Number of bytes to write
+    * @return None
+    */
+    void writeBytes(const uint8_t* data, const uint32_t& size);
+
+    /**
+    * @brief  Gets the number of bytes of the state written so far
+    * @param  None
+    * @return Number of bytes written, including the ones that overflowed the buffer
+    */
+    uint32_t getSize() const;
+
+    /**
+    * @brief  Checks whether the whole state fitted in the buffer
+    * @param  None
+    * @return True if nothing overflowed the buffer, false otherwise
+    */
+    bool isValid() const;
+
+private:
+    uint8_t* buffer_;
+    const uint32_t buffer_size_;
+    uint32_t offset_;
+};
+
+// Reads the state of the emulator back from a buffer written by SaveStateWriter
+class SaveStateReader {
+public:
+    /**
+    * @brief  Constructor for SaveStateReader
+    * @param  buffer: The buffer to read from
+    * @param  buffer_size: The size of the buffer in bytes
+    * @return None
+    */
+    SaveStateReader(const uint8_t* buffer, const uint32_t& buffer_size);
+
+    /**
+    * @brief  Reads a value from the buffer
+    * @param  value: The value to read into
+    * @return None
+    */
+    template<typename T>
+    void read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be loaded");
+        readBytes(reinterpret_cast<uint8_t*>(&value), sizeof(T));
+    }
+
+    /**
+    * @brief  Reads a block of bytes from the buffer
+    *   Nothing is read once the end of the buffer is passed
+    * @param  data: The bytes to read into
+    * @param  size: Number of bytes to read
+    * @return None
+    */
+    void readBytes(uint8_t* data, const uint32_t& size);
+
+    /**
+    * @brief  Checks whether every read was within the buffer
+    * @param  None
+    * @return True if no read passed the end of the buffer, false otherwise
+    */
+    bool isValid() const;
+
+private:
+    const uint8_t* buffer_;
+    const uint32_t buffer_size_;
+    uint32_t offset_;
+    bool is_valid_;
+};
+
+#endif
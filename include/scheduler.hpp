@@ -0,0 +1,76 @@
+#ifndef _SCHEDULER_HPP_
+#define _SCHEDULER_HPP_
+// Standard Library Headers
+#include <array>
+#include <cstdint>
+// Project Defines
+// Time of an event that isn't scheduled
+#define SCHEDULER_NO_EVENT UINT64_MAX
+
+// Keeps the master clock time of the next event of each component, so the system can run freely until the earliest one
+//   Each kind of event has a single slot, scheduling it again replaces its time
+class Scheduler {
+public:
+    enum class Event : uint8_t {
+        // PPU sets the VBlank flag and may request an NMI
+        PPU_VBLANK = 0,
+        // APU frame sequencer clocks its units and may raise the frame IRQ
+        APU_FRAME_SEQUENCER = 1,
+        COUNT = 2,
+    };
+
+    // Constructor, no event is scheduled
+    Scheduler();
+
+    /**
+    * @brief  Schedules an event, replacing its previous time
+    * @param  event: The event to schedule
+    * @param  time: Master clock time the event happens at
+    * @return None
+    */
+    void schedule(const Event& event, const uint64_t& time);
+
+    /**
+    * @brief  Removes an event from the schedule
+    * @param  event: The event to remove
+    * @return None
+    */
+    void cancel(const Event& event);
+
+    /**
+    * @brief  Removes every event from the schedule
+    * @param  None
+    * @return None
+    */
+    void clear();
+
+    /**
+    * @brief  Gets the time of the earliest scheduled event
+    * @param  None
+    * @return Master clock time of the event, SCHEDULER_NO_EVENT if nothing is scheduled
+    */
+    uint64_t getNextEventTime() const;
+
+    /**
+    * @brief  Removes the earliest event if it happens at or before a time
+    * @param  time: The current master clock time
+    * @param  event: Set to the event removed
+    * @return True if an event was due and removed, false otherwise
+    */
+    bool popDueEvent(const uint64_t& time, Event& event);
+
+private:
+    std::array<uint64_t, static_cast<uint8_t>(Event::COUNT)> event_times_;
+    // Earliest event, kept up to date so the main loop only compares against its time
+    Event next_event_;
+    uint64_t next_event_time_;
+
+    /**
+    * @brief  Finds the earliest scheduled event
+    * @param  None
+    * @return None
+    */
+    void updateNextEvent();
+};
+
+#endif
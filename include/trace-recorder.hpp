@@ -0,0 +1,107 @@
+#ifndef _TRACE_RECORDER_HPP_
+#define _TRACE_RECORDER_HPP_
+// Standard Library Headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+// Project Defines
+// Records a begin event here and an end event at the end of the enclosing scope, while the trace recorder is recording
+//   The name must be a string literal, only its pointer is kept
+#define NES_TRACE_SCOPE(name) const TraceRecorder::Scope nes_trace_scope_(name)
+
+// Records begin and end events of the emulation phases into a ring buffer, to be viewed as a timeline
+//   Any thread can record, each event keeps the ID of the thread it was recorded on
+//   The buffer is allocated when recording starts, recording an event never allocates, and the oldest events are
+//   overwritten once the buffer is full. The events are written out as Chrome trace JSON, which Perfetto also reads
+class TraceRecorder {
+public:
+    // Records a begin event on construction and the matching end event on destruction
+    class Scope {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        // Null if the recorder wasn't recording when the scope began
+        const char* name_;
+    };
+
+    /**
+    * @brief  Gets the recorder shared by every thread of the process
+    * @param  None
+    * @return The recorder
+    */
+    static TraceRecorder& getInstance();
+
+    /**
+    * @brief  Starts recording into a new buffer, the events recorded before are dropped
+    *   Must not be called while recording
+    * @param  event_capacity: Number of events kept, rounded up to a power of 2
+    * @return None
+    */
+    void start(const uint32_t& event_capacity);
+
+    /**
+    * @brief  Stops recording, the events recorded are kept until the next start
+    * @param  None
+    * @return None
+    */
+    void stop();
+
+    /**
+    * @brief  Checks if events are being recorded
+    * @param  None
+    * @return True if recording, false otherwise
+    */
+    bool isRecording() const;
+
+    /**
+    * @brief  Records an event, if recording
+    * @param  name: Name of the event, must outlive the recorder
+    * @param  phase: 'B' for the begin of a phase, 'E' for its end
+    * @return None
+    */
+    void record(const char* name, const char& phase);
+
+    /**
+    * @brief  Writes the events kept, oldest first, as Chrome trace JSON
+    *   Events overwritten or being recorded while writing are skipped
+    * @param  stream: The stream to write to
+    * @return None
+    */
+    void writeChromeTrace(std::ostream& stream) const;
+
+private:
+    // The fields are atomics so the trace can be written while other threads record, they are only accessed
+    // with relaxed ordering and the sequence tells if they were all written by the same event
+    struct Event {
+        // Index of the event stored in the slot, plus 1, or 0 while the slot is being written
+        std::atomic<uint64_t> sequence;
+        std::atomic<const char*> name;
+        // Nanoseconds since recording started
+        std::atomic<uint64_t> timestamp;
+        std::atomic<uint32_t> thread_id;
+        std::atomic<char> phase;
+    };
+
+    TraceRecorder();
+
+    std::atomic<bool> is_recording_;
+    std::unique_ptr<Event[]> events_;
+    uint64_t event_mask_;
+    // Index of the next event to record, counting every event since recording started
+    std::atomic<uint64_t> write_index_;
+    std::chrono::steady_clock::time_point start_time_;
+
+    /**
+    * @brief  Gets a small ID of the calling thread, assigned the first time the thread records an event
+    * @param  None
+    * @return ID of the thread, starting at 1
+    */
+    static uint32_t getThreadID();
+};
+
+#endif
@@ -104,11 +104,14 @@ const std::array<std::array<uint8_t, 8>, 4> APU::PulseChannel::s_duty_value_tabl
 APU::PulseChannel::PulseChannel(void (*timer_period_modifier_)(uint16_t& timer_reload, const uint16_t& change)): 
     is_enabled_(false), duty_cycle_(0), duty_value_(0), timer_period_modifier_(timer_period_modifier_) {}
 
-void APU::PulseChannel::clockTimer() {
+bool APU::PulseChannel::clockTimer() {
+    // Output changes when the duty steps, or when the timer crosses the value that silences the channel
+    const bool is_output_changing = (timer_.value == 0) || (timer_.value == 8);
     if (timer_.value == 0) {
         duty_value_ = (duty_value_ + 1) % 8;
     }
     timer_.clock();
+    return is_output_changing;
 }
 
 void APU::PulseChannel::clockSweep() {
@@ -161,16 +164,18 @@ const std::array<uint8_t, 32> APU::TriangleChannel::s_duty_value_table = { {
 
 APU::TriangleChannel::TriangleChannel(): is_enabled_(false), duty_value_(0) {}
 
-void APU::TriangleChannel::clockTimer() {
+bool APU::TriangleChannel::clockTimer() {
     if (timer_.value > 0) {
         timer_.value--;
-        return;
+        return false;
     }
     // Reload Timer
     timer_.value = timer_.period + 1;
     if ((length_counter_.value > 0) && (linear_counter_.value > 0)) {
         duty_value_ = (duty_value_ + 1) % 32;
+        return true;
     }
+    return false;
 }
 
 void APU::TriangleChannel::clockLengthCounter() {
@@ -207,7 +212,36 @@ uint8_t APU::TriangleChannel::getOutput() const {
     return s_duty_value_table.at(duty_value_);
 }
 
-APU::APU(): clock_count_(0), sequencer_value_(0), sequencer_mode_(SequencerMode::FourStep), irq_inhibit_(false), frame_irq_(false), irq_requested_(false) {}
+// From NESDev Wiki: the 4-step sequence raises the frame IRQ over its last 3 cycles
+const std::array<std::array<std::array<APU::SequencerStep, APU_SEQUENCER_STEP_COUNT>, 2>, 2> APU::s_sequencer_steps = {{
+    // NTSC
+    {{
+        // 4-step
+        {{{7457, true, false, false}, {14913, true, true, false}, {22371, true, false, false}, {29828, false, false, true}, {29829, true, true, true}, {29830, false, false, true}}},
+        // 5-step
+        {{{7457, true, false, false}, {14913, true, true, false}, {22371, true, false, false}, {29829, false, false, false}, {37281, true, true, false}, {37282, false, false, false}}},
+    }},
+    // PAL
+    {{
+        // 4-step
+        {{{8313, true, false, false}, {16627, true, true, false}, {24939, true, false, false}, {33252, false, false, true}, {33253, true, true, true}, {33254, false, false, true}}},
+        // 5-step
+        {{{8313, true, false, false}, {16627, true, true, false}, {24939, true, false, false}, {33253, false, false, false}, {41565, true, true, false}, {41566, false, false, false}}},
+    }},
+}};
+
+APU::APU(): clock_count_(0), region_(Region::NTSC), sequencer_value_(0), sequencer_mode_(SequencerMode::FourStep), 
+    sequencer_countdown_(s_sequencer_steps[static_cast<uint8_t>(Region::NTSC)][static_cast<uint8_t>(SequencerMode::FourStep)][0].cycle),
+    irq_inhibit_(false), frame_irq_(false), irq_requested_(false), sound_system_(nullptr), perf_counters_(nullptr),
+    audio_buffer_(APU_NTSC_CLOCK_RATE, NES_SOUND_SAMPLE_RATE, APU_AUDIO_BUFFER_SIZE), audio_samples_(APU_AUDIO_BUFFER_SIZE), audio_clock_count_(0),
+    audio_max_clock_count_(audio_buffer_.getMaxFrameClockCount()), is_audio_output_changed_(true), audio_pulse_input_(0), audio_tnd_input_(0), audio_amplitude_(0) {}
+
+void APU::setRegion(const Region& region) {
+    region_ = region;
+    audio_buffer_.setClockRate((region_ == Region::PAL) ? APU_PAL_CLOCK_RATE : APU_NTSC_CLOCK_RATE);
+    audio_max_clock_count_ = audio_buffer_.getMaxFrameClockCount();
+    resetSequencer();
+}
 
 uint8_t APU::readAPURegister(const uint8_t& address) {
     switch (address) {
@@ -218,6 +252,7 @@ uint8_t APU::readAPURegister(const uint8_t& address) {
 }
 
 bool APU::writeAPURegister(const uint8_t& address, const uint8_t& data) {
+    is_audio_output_changed_ = true;
     switch (address) {
     // Done
     case 0x00:
@@ -318,17 +353,22 @@ bool APU::writeAPURegister(const uint8_t& address, const uint8_t& data) {
         break;
     case 0x17:
         sequencer_mode_ = static_cast<APU::SequencerMode>((data & 0b10000000) > 0);
-        frame_irq_ = (data & 0b01000000) > 0;
+        // Setting the inhibit flag also clears a pending frame IRQ
+        irq_inhibit_ = (data & 0b01000000) > 0;
+        if (irq_inhibit_) {
+            frame_irq_ = false;
+        }
+        resetSequencer();
         break;
     }
     return true;
 }
 
 void APU::clockTimers() {
-    triangle_channel.clockTimer();
+    is_audio_output_changed_ |= triangle_channel.clockTimer();
     if (clock_count_ % 2) {
-        pulse_1_channel.clockTimer();
-        pulse_2_channel.clockTimer();
+        is_audio_output_changed_ |= pulse_1_channel.clockTimer();
+        is_audio_output_changed_ |= pulse_2_channel.clockTimer();
     //   this->chan.noise.timer_clock();
     //   this->chan.dmc.timer_clock(this->mem, this->interrupt);
     }
@@ -354,77 +394,61 @@ void APU::clockSweeps() {
 }
 
 void APU::clockSequencer() {
-    sequencer_value_++;
-
-    switch (sequencer_mode_) {
-    case SequencerMode::FourStep: {
-        sequencer_value_ %= 4;
-        switch (sequencer_value_) {
-        case 0:
-            clockEnvelopes();
-            break;
-        case 1:
-            clockSweeps();
-            clockLengthCounters();
-            break;
-        case 2:
-            clockEnvelopes();
-            break;
-        case 3:
-            clockSweeps();
-            clockLengthCounters();
-            if (!irq_inhibit_) {
-                frame_irq_ = true;
-            }
-            break;
-        }
+    const std::array<SequencerStep, APU_SEQUENCER_STEP_COUNT>& steps = s_sequencer_steps[static_cast<uint8_t>(region_)][static_cast<uint8_t>(sequencer_mode_)];
+    const SequencerStep& step = steps[sequencer_value_];
+
+    if (step.is_quarter_frame) {
+        clockEnvelopes();
     }
-    break;
-
-    case SequencerMode::FiveStep: {
-        sequencer_value_ %= 5;
-        switch (sequencer_value_) {
-            case 0:
-                clockEnvelopes();
-                break;
-            case 1:
-                clockEnvelopes();
-                clockSweeps();
-                clockLengthCounters();
-                break;
-            case 2:
-                clockEnvelopes();
-                break;
-            case 3:
-                clockEnvelopes();
-                clockSweeps();
-                clockLengthCounters();
-                break;
-        }
+    if (step.is_half_frame) {
+        clockSweeps();
+        clockLengthCounters();
     }
-    break;
+    if (step.is_frame_irq && !irq_inhibit_) {
+        frame_irq_ = true;
+    }
+    is_audio_output_changed_ = true;
+
+    // The last step is also the first cycle of the next sequence
+    const uint16_t step_cycle = (sequencer_value_ == APU_SEQUENCER_STEP_COUNT - 1) ? 0 : step.cycle;
+    sequencer_value_ = (sequencer_value_ + 1) % APU_SEQUENCER_STEP_COUNT;
+    sequencer_countdown_ = steps[sequencer_value_].cycle - step_cycle;
+}
+
+void APU::resetSequencer() {
+    sequencer_value_ = 0;
+    sequencer_countdown_ = s_sequencer_steps[static_cast<uint8_t>(region_)][static_cast<uint8_t>(sequencer_mode_)][0].cycle;
+
+    // Starting the 5-step sequence clocks the quarter and half frame units right away
+    if (sequencer_mode_ == SequencerMode::FiveStep) {
+        clockEnvelopes();
+        clockSweeps();
+        clockLengthCounters();
+        is_audio_output_changed_ = true;
     }
 }
 
 void APU::clockAPU() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::APU);
+
     clock_count_++;
     clockTimers();
 
-    // For more accurate clocking
-    uint64_t previous_clcok_count = clock_count_ - 1;
-
-    // APU is clocked every CPU clock (1789773Hz) and Sequencer is clocked at 240Hz
-    //   So sequncer clocks every 1789773 / 240 = 7457.3875 apu cycles
-    if (static_cast<uint64_t>(previous_clcok_count / 7457.3875f) != static_cast<uint64_t>(clock_count_ / 7457.3875f)) {
+    // Sequencer only runs on the cycles of its steps
+    sequencer_countdown_--;
+    if (sequencer_countdown_ == 0) {
         clockSequencer();
     }
 
-    // Sample Rate is 44100Hz, so similar to clocking sequencer
-    //   We will sample every 1789773 / 44100 = 40.5844217687 apu cycles
-    if (static_cast<uint64_t>(previous_clcok_count / 40.5844217687f) != static_cast<uint64_t>(clock_count_ / 40.5844217687f)) {
-        if (sound_system_) {
-            float sampleOut = sampleMixerOut(pulse_1_channel.getOutput(), pulse_2_channel.getOutput(), triangle_channel.getOutput(), 0, 0);
-            sound_system_->queueSample(sampleOut);
+    // Samples are synthesized from the changes of the mixer output, instead of sampling it at the sample rate
+    if (sound_system_) {
+        if (is_audio_output_changed_) {
+            updateAudioOutput();
+            is_audio_output_changed_ = false;
+        }
+        audio_clock_count_++;
+        if (audio_clock_count_ >= audio_max_clock_count_) {
+            endAudioFrame();
         }
     }
 
@@ -434,10 +458,138 @@ void APU::clockAPU() {
     }
 }
 
+uint16_t APU::getCyclesUntilSequencerStep() const {
+    return sequencer_countdown_;
+}
+
+void APU::endAudioFrame() {
+    audio_buffer_.endFrame(audio_clock_count_);
+    audio_clock_count_ = 0;
+
+    const uint32_t sample_count = audio_buffer_.readSamples(audio_samples_.data(), APU_AUDIO_BUFFER_SIZE);
+    if (sound_system_) {
+        for (uint32_t i = 0; i < sample_count; i++) {
+            sound_system_->queueSample(static_cast<float>(audio_samples_[i]) / APU_AUDIO_AMPLITUDE);
+        }
+    }
+    audio_max_clock_count_ = audio_buffer_.getMaxFrameClockCount();
+}
+
+void APU::updateAudioOutput() {
+    const uint8_t pulse_1 = pulse_1_channel.getOutput();
+    const uint8_t pulse_2 = pulse_2_channel.getOutput();
+    const uint8_t triangle = triangle_channel.getOutput();
+
+    // Mixer output only changes with its inputs
+    const uint8_t pulse_input = pulse_1 + pulse_2;
+    const uint8_t tnd_input = 3 * triangle;
+    if ((pulse_input == audio_pulse_input_) && (tnd_input == audio_tnd_input_)) {
+        return;
+    }
+    audio_pulse_input_ = pulse_input;
+    audio_tnd_input_ = tnd_input;
+
+    const int32_t amplitude = static_cast<int32_t>(std::lround(sampleMixerOut(pulse_1, pulse_2, triangle, 0, 0) * APU_AUDIO_AMPLITUDE));
+    audio_buffer_.addDelta(audio_clock_count_, amplitude - audio_amplitude_);
+    audio_amplitude_ = amplitude;
+}
+
 void APU::connectSoundSystem(NESSound& sound_system) {
     sound_system_ = &sound_system;
 }
 
+void APU::connectPerfCounters(PerfCounters* perf_counters) {
+    perf_counters_ = perf_counters;
+}
+
+void APU::disconnectSoundSystem() {
+    sound_system_ = nullptr;
+}
+
+void APU::saveState(SaveStateWriter& writer) const {
+    writer.write(clock_count_);
+    writer.write(sequencer_value_);
+    writer.write(sequencer_mode_);
+    writer.write(sequencer_countdown_);
+    writer.write(irq_inhibit_);
+    writer.write(frame_irq_);
+    writer.write(irq_requested_);
+
+    // The timer period modifiers are fixed per channel, so they are not saved
+    for (const PulseChannel* pulse_channel : {&pulse_1_channel, &pulse_2_channel}) {
+        writer.write(pulse_channel->is_enabled_);
+        writer.write(pulse_channel->duty_cycle_);
+        writer.write(pulse_channel->duty_value_);
+        writer.write(pulse_channel->timer_);
+        writer.write(pulse_channel->length_counter_);
+        writer.write(pulse_channel->envelope_);
+        writer.write(pulse_channel->sweep_);
+    }
+
+    writer.write(triangle_channel.is_enabled_);
+    writer.write(triangle_channel.duty_value_);
+    writer.write(triangle_channel.timer_);
+    writer.write(triangle_channel.length_counter_);
+    writer.write(triangle_channel.linear_counter_);
+
+    writer.write(noise_channel);
+    writer.write(dmc_channel);
+
+    // The audio output carries over from one frame to the next, so it is saved for the audio to replay exactly
+    audio_buffer_.saveState(writer);
+    writer.write(audio_clock_count_);
+    writer.write(is_audio_output_changed_);
+    writer.write(audio_pulse_input_);
+    writer.write(audio_tnd_input_);
+    writer.write(audio_amplitude_);
+}
+
+void APU::loadState(SaveStateReader& reader) {
+    reader.read(clock_count_);
+    reader.read(sequencer_value_);
+    reader.read(sequencer_mode_);
+    reader.read(sequencer_countdown_);
+    reader.read(irq_inhibit_);
+    reader.read(frame_irq_);
+    reader.read(irq_requested_);
+
+    for (PulseChannel* pulse_channel : {&pulse_1_channel, &pulse_2_channel}) {
+        reader.read(pulse_channel->is_enabled_);
+        reader.read(pulse_channel->duty_cycle_);
+        reader.read(pulse_channel->duty_value_);
+        reader.read(pulse_channel->timer_);
+        reader.read(pulse_channel->length_counter_);
+        reader.read(pulse_channel->envelope_);
+        reader.read(pulse_channel->sweep_);
+    }
+
+    reader.read(triangle_channel.is_enabled_);
+    reader.read(triangle_channel.duty_value_);
+    reader.read(triangle_channel.timer_);
+    reader.read(triangle_channel.length_counter_);
+    reader.read(triangle_channel.linear_counter_);
+
+    reader.read(noise_channel);
+    reader.read(dmc_channel);
+
+    audio_buffer_.loadState(reader);
+    reader.read(audio_clock_count_);
+    reader.read(is_audio_output_changed_);
+    reader.read(audio_pulse_input_);
+    reader.read(audio_tnd_input_);
+    reader.read(audio_amplitude_);
+    // Changes recorded in a frame in progress aren't saved, so the output restarts from silence to stay consistent
+    if (audio_clock_count_ != 0) {
+        audio_buffer_.clear();
+        audio_clock_count_ = 0;
+        audio_pulse_input_ = 0;
+        audio_tnd_input_ = 0;
+        audio_amplitude_ = 0;
+        is_audio_output_changed_ = true;
+    }
+    audio_max_clock_count_ = audio_buffer_.getMaxFrameClockCount();
+}
+
 float APU::samplePulseOut(const uint8_t& pulse_1, const uint8_t& pulse_2) const {
     return pulse_table.at(pulse_1 + pulse_2);
 }
@@ -460,12 +612,12 @@ float APU::sampleSquarePulseWave(const float& frequency, const float& time) {
 
     float sine_wave_a = 0.0f;
     for (uint8_t i = 1; i < harmonics; i++) {
-        sine_wave_a += std::sinf(x * frequency * (2 * std::numbers::pi_v<float>) * i) / i;
+        sine_wave_a += std::sin(x * frequency * (2 * std::numbers::pi_v<float>) * i) / i;
     }
 
     float sine_wave_b = 0.0f;
     for (uint8_t i = 1; i < harmonics; i++) {
-        sine_wave_b += std::sinf((x * frequency - phase) * (2 * std::numbers::pi_v<float>) * i) / i;
+        sine_wave_b += std::sin((x * frequency - phase) * (2 * std::numbers::pi_v<float>) * i) / i;
     }
 
     return sine_wave_a - sine_wave_b;
@@ -0,0 +1,125 @@
+#include "blip-buffer.hpp"
+// Standard Library Headers
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+// File specific constants
+// Cutoff of the kernel, as a fraction of the Nyquist frequency of the output
+static constexpr double S_KERNEL_CUTOFF = 0.9;
+
+BlipBuffer::BlipBuffer(const uint32_t& clock_rate, const uint32_t& sample_rate, const uint32_t& sample_capacity):
+    sample_rate_(sample_rate), clock_to_sample_factor_(0),
+    sample_capacity_(sample_capacity), frame_end_time_(0), deltas_(sample_capacity + BLIP_BUFFER_KERNEL_WIDTH, 0), amplitude_(0) {
+    setClockRate(clock_rate);
+}
+
+void BlipBuffer::setClockRate(const uint32_t& clock_rate) {
+    clock_to_sample_factor_ = ((static_cast<uint64_t>(sample_rate_) << BLIP_BUFFER_TIME_BITS) + (clock_rate / 2)) / clock_rate;
+}
+
+void BlipBuffer::addDelta(const uint32_t& clock, const int32_t& delta) {
+    const uint64_t time = frame_end_time_ + (clock * clock_to_sample_factor_);
+    const uint64_t index = time >> BLIP_BUFFER_TIME_BITS;
+    // The delta would be spread past the end of the buffer
+    if (index >= sample_capacity_) {
+        return;
+    }
+    const uint32_t phase = (time >> (BLIP_BUFFER_TIME_BITS - BLIP_BUFFER_PHASE_BITS)) & (BLIP_BUFFER_PHASE_COUNT - 1);
+
+    const std::array<int32_t, BLIP_BUFFER_KERNEL_WIDTH>& kernel = getKernel()[phase];
+    int32_t* deltas = deltas_.data() + index;
+    for (uint32_t i = 0; i < BLIP_BUFFER_KERNEL_WIDTH; i++) {
+        deltas[i] += delta * kernel[i];
+    }
+}
+
+void BlipBuffer::endFrame(const uint32_t& clock_count) {
+    frame_end_time_ += clock_count * clock_to_sample_factor_;
+}
+
+uint32_t BlipBuffer::getSampleCount() const {
+    return static_cast<uint32_t>(std::min<uint64_t>(frame_end_time_ >> BLIP_BUFFER_TIME_BITS, sample_capacity_));
+}
+
+uint32_t BlipBuffer::getMaxFrameClockCount() const {
+    const uint64_t free_time = (static_cast<uint64_t>(sample_capacity_ - getSampleCount()) << BLIP_BUFFER_TIME_BITS) -
+        (frame_end_time_ & ((static_cast<uint64_t>(1) << BLIP_BUFFER_TIME_BITS) - 1));
+    return static_cast<uint32_t>(std::min<uint64_t>(free_time / clock_to_sample_factor_, UINT32_MAX));
+}
+
+uint32_t BlipBuffer::readSamples(int32_t* samples, const uint32_t& sample_count) {
+    const uint32_t available_count = getSampleCount();
+    const uint32_t read_count = std::min(sample_count, available_count);
+
+    // The deltas are the differences between samples, so the samples are their running sum
+    for (uint32_t i = 0; i < read_count; i++) {
+        amplitude_ += deltas_[i];
+        samples[i] = amplitude_ >> BLIP_BUFFER_KERNEL_BITS;
+    }
+
+    // Move the deltas that weren't read, including the kernel past the last sample, to the start of the buffer
+    const uint32_t used_count = available_count + BLIP_BUFFER_KERNEL_WIDTH;
+    std::copy(deltas_.begin() + read_count, deltas_.begin() + used_count, deltas_.begin());
+    std::fill(deltas_.begin() + (used_count - read_count), deltas_.begin() + used_count, 0);
+    frame_end_time_ -= static_cast<uint64_t>(read_count) << BLIP_BUFFER_TIME_BITS;
+
+    return read_count;
+}
+
+void BlipBuffer::clear() {
+    frame_end_time_ = 0;
+    std::fill(deltas_.begin(), deltas_.end(), 0);
+    amplitude_ = 0;
+}
+
+void BlipBuffer::saveState(SaveStateWriter& writer) const {
+    // Only the time within the first sample is kept, as the samples before it are not saved
+    writer.write(frame_end_time_ & ((static_cast<uint64_t>(1) << BLIP_BUFFER_TIME_BITS) - 1));
+    writer.write(amplitude_);
+    writer.writeBytes(reinterpret_cast<const uint8_t*>(deltas_.data()), BLIP_BUFFER_KERNEL_WIDTH * sizeof(int32_t));
+}
+
+void BlipBuffer::loadState(SaveStateReader& reader) {
+    clear();
+    reader.read(frame_end_time_);
+    reader.read(amplitude_);
+    reader.readBytes(reinterpret_cast<uint8_t*>(deltas_.data()), BLIP_BUFFER_KERNEL_WIDTH * sizeof(int32_t));
+}
+
+const BlipBuffer::Kernel& BlipBuffer::getKernel() {
+    static const Kernel kernel = []() {
+        Kernel built_kernel;
+        constexpr double half_width = BLIP_BUFFER_KERNEL_WIDTH / 2;
+        constexpr int32_t unit = 1 << BLIP_BUFFER_KERNEL_BITS;
+
+        for (uint32_t phase = 0; phase < BLIP_BUFFER_PHASE_COUNT; phase++) {
+            // The step lands between the two middle samples of the kernel, offset by the phase
+            const double center = (half_width - 1) + (static_cast<double>(phase) / BLIP_BUFFER_PHASE_COUNT);
+
+            // Blackman windowed sinc
+            std::array<double, BLIP_BUFFER_KERNEL_WIDTH> taps;
+            double sum = 0.0;
+            for (uint32_t i = 0; i < BLIP_BUFFER_KERNEL_WIDTH; i++) {
+                const double x = i - center;
+                const double sinc = (x == 0.0) ? 1.0 : std::sin(std::numbers::pi * S_KERNEL_CUTOFF * x) / (std::numbers::pi * S_KERNEL_CUTOFF * x);
+                const double window = 0.42 + (0.5 * std::cos(std::numbers::pi * x / half_width)) + (0.08 * std::cos(2 * std::numbers::pi * x / half_width));
+                taps[i] = sinc * window;
+                sum += taps[i];
+            }
+
+            // Scale to fixed point, then put the rounding error in the largest tap so the phase adds up to exactly one unit
+            int32_t fixed_sum = 0;
+            uint32_t largest_tap = 0;
+            for (uint32_t i = 0; i < BLIP_BUFFER_KERNEL_WIDTH; i++) {
+                built_kernel[phase][i] = static_cast<int32_t>(std::lround(taps[i] / sum * unit));
+                fixed_sum += built_kernel[phase][i];
+                if (built_kernel[phase][i] > built_kernel[phase][largest_tap]) {
+                    largest_tap = i;
+                }
+            }
+            built_kernel[phase][largest_tap] += unit - fixed_sum;
+        }
+        return built_kernel;
+    }();
+    return kernel;
+}
@@ -1,51 +1,49 @@
 #include "cartridge.hpp"
+// Standard Library Headers
+#include <cstring>
 
 std::unique_ptr<Cartridge> Cartridge::makeCartridge(std::istream& rom_data_stream) {
     Header header;
+    RomLayout layout;
     // Reads the header
     rom_data_stream.read(reinterpret_cast<char*>(&header), sizeof(Header));
-    // Ignore training data
-    if (header.mapper1 & 0x04) {
-        rom_data_stream.seekg(512, std::ios_base::cur);
+    if (!parseHeader(header, layout)) {
+        return nullptr;
     }
+    // Ignore training data
+    rom_data_stream.seekg(layout.trainer_size, std::ios_base::cur);
 
-    // Determine the mapper ID
-    uint8_t mapper_id = (header.mapper2 & 0xF0) | (header.mapper1 >> 4);
-
-    // Determine the Mirror Mode
-    MirrorMode mirror_mode = (header.mapper1 & 0x01) ? MirrorMode::VERTICAL : MirrorMode::HORIZONTAL;
+    // Read the program memory followed by the pattern memory, then share the image of any cartridge with the same ROM
+    std::unique_ptr<uint8_t[]> rom_data = std::make_unique<uint8_t[]>(layout.prg_rom_size + layout.chr_rom_size);
+    rom_data_stream.read(reinterpret_cast<char*>(rom_data.get()), layout.prg_rom_size + layout.chr_rom_size);
+    std::shared_ptr<const RomImage> rom_image = RomImage::getRomImage(std::move(rom_data), layout.prg_rom_size, layout.chr_rom_size);
 
-    // ROM file type
-    uint8_t file_type = 1;
+    return std::unique_ptr<Cartridge>(new Cartridge(layout.mapper_id, std::move(rom_image), layout.mirror_mode));
+}
 
-    // Size of the ROM chunks
-    uint16_t prg_rom_chunk_size = 0x0000;
-    uint16_t chr_rom_chunk_size = 0x0000;
+std::unique_ptr<Cartridge> Cartridge::makeCartridge(const std::string& path) {
+    std::shared_ptr<const MappedFile> file = MappedFile::mapFile(path);
+    if (!file || (file->getSize() < sizeof(Header))) {
+        return nullptr;
+    }
 
-    switch (file_type) {
-        // iNES 1.0
-        case 1: {
-            prg_rom_chunk_size = 0x4000;
-            chr_rom_chunk_size = 0x2000;
-        }
-        break;
-        // iNES 2.0
-        case 2: {
+    Header header;
+    RomLayout layout;
+    std::memcpy(&header, file->getData(), sizeof(Header));
+    if (!parseHeader(header, layout)) {
+        return nullptr;
+    }
 
-        }
-        break;
-        // Unsupported file type
-        default: {
-            return nullptr;
-        }
+    // The ROM is only read from the file when the emulator touches its pages
+    std::shared_ptr<const RomImage> rom_image = RomImage::makeMappedRomImage(std::move(file), sizeof(Header) + layout.trainer_size, layout.prg_rom_size, layout.chr_rom_size);
+    if (!rom_image) {
+        return nullptr;
     }
+    return std::unique_ptr<Cartridge>(new Cartridge(layout.mapper_id, std::move(rom_image), layout.mirror_mode));
+}
 
-    std::unique_ptr<Cartridge> instance = std::unique_ptr<Cartridge>(new Cartridge(mapper_id, header.prg_rom_chunks * prg_rom_chunk_size, header.chr_rom_chunks * chr_rom_chunk_size, mirror_mode));
-    // Read the program memory and stores it in the instance
-    rom_data_stream.read(reinterpret_cast<char*>(instance->prg_rom_memory_.getPointer()), instance->prg_rom_memory_.getSize());
-    // Read the pattern memory section and stores it in the instance
-    rom_data_stream.read(reinterpret_cast<char*>(instance->chr_memory_.getPointer()), instance->chr_memory_.getSize());
-    return std::move(instance);
+const RomImage& Cartridge::getRomImage() const {
+    return *rom_image_;
 }
 
 uint8_t Cartridge::readPrgMem(const uint16_t& address) const {
@@ -53,7 +51,15 @@ uint8_t Cartridge::readPrgMem(const uint16_t& address) const {
     if (mapped_address < MAPPER_PRG_RAM_REGION_SIZE) {
         return prg_ram_memory_.read(mapped_address);
     }
-    return prg_rom_memory_.read(mapped_address - MAPPER_PRG_RAM_REGION_SIZE);
+    return rom_image_->getPrgRom()[mapped_address - MAPPER_PRG_RAM_REGION_SIZE];
+}
+
+const uint8_t* Cartridge::getPrgMemPage(const uint16_t& address) const {
+    uint16_t mapped_address = mapper_->mapCPUReadAddress(address);
+    if (mapped_address < MAPPER_PRG_RAM_REGION_SIZE) {
+        return prg_ram_memory_.getPointer() + mapped_address;
+    }
+    return rom_image_->getPrgRom() + (mapped_address - MAPPER_PRG_RAM_REGION_SIZE);
 }
 
 bool Cartridge::writeToPrgMem(const uint16_t& address, const uint8_t& data) {
@@ -67,18 +73,80 @@ bool Cartridge::writeToPrgMem(const uint16_t& address, const uint8_t& data) {
 }
 
 uint8_t Cartridge::readChrMem(const uint16_t& address) const {
-    return chr_memory_.read(mapper_->mapPPUReadAddress(address));
+    return chr_memory_[mapper_->mapPPUReadAddress(address)];
+}
+
+const uint8_t* Cartridge::getChrMemPage(const uint16_t& address) const {
+    return chr_memory_ + mapper_->mapPPUReadAddress(address);
 }
 
 bool Cartridge::writeToChrMem(const uint16_t& address, const uint8_t& data) {
-    return chr_memory_.write(mapper_->mapPPUWriteAddress(address), data);
+    // CHR ROM is shared between cartridges, so only CHR RAM can be written
+    if (chr_ram_memory_.getSize() == 0) {
+        return false;
+    }
+    return chr_ram_memory_.write(mapper_->mapPPUWriteAddress(address), data);
 }
 
 Cartridge::MirrorMode Cartridge::getMirrorMode() const {
     return mirror_mode_;
 }
 
-Cartridge::Cartridge(const uint8_t& mapper_id, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size, const MirrorMode& mirror_mode): 
-    prg_ram_memory_(MAPPER_PRG_RAM_REGION_SIZE), prg_rom_memory_(prg_rom_size), chr_memory_(chr_rom_size), 
-    mapper_(Mapper::makeMapper(mapper_id, MAPPER_PRG_RAM_REGION_SIZE, prg_rom_size, chr_rom_size)),
+void Cartridge::saveState(SaveStateWriter& writer) const {
+    prg_ram_memory_.saveState(writer);
+    chr_ram_memory_.saveState(writer);
+    mapper_->saveState(writer);
+}
+
+void Cartridge::loadState(SaveStateReader& reader) {
+    prg_ram_memory_.loadState(reader);
+    chr_ram_memory_.loadState(reader);
+    mapper_->loadState(reader);
+}
+
+Cartridge::Cartridge(const uint8_t& mapper_id, std::shared_ptr<const RomImage> rom_image, const MirrorMode& mirror_mode): 
+    prg_ram_memory_(MAPPER_PRG_RAM_REGION_SIZE), rom_image_(std::move(rom_image)), 
+    chr_ram_memory_((rom_image_->getChrRomSize() == 0) ? CARTRIDGE_CHR_RAM_SIZE : 0),
+    chr_memory_((rom_image_->getChrRomSize() == 0) ? chr_ram_memory_.getPointer() : rom_image_->getChrRom()),
+    mapper_(Mapper::makeMapper(mapper_id, MAPPER_PRG_RAM_REGION_SIZE, rom_image_->getPrgRomSize(), (rom_image_->getChrRomSize() == 0) ? CARTRIDGE_CHR_RAM_SIZE : rom_image_->getChrRomSize())),
     mirror_mode_(mirror_mode) {}
+
+bool Cartridge::parseHeader(const Header& header, RomLayout& layout) {
+    // Training data sits between the header and the program memory
+    layout.trainer_size = (header.mapper1 & 0x04) ? 512 : 0;
+
+    // Determine the mapper ID
+    layout.mapper_id = (header.mapper2 & 0xF0) | (header.mapper1 >> 4);
+
+    // Determine the Mirror Mode
+    layout.mirror_mode = (header.mapper1 & 0x01) ? MirrorMode::VERTICAL : MirrorMode::HORIZONTAL;
+
+    // ROM file type
+    uint8_t file_type = 1;
+
+    // Size of the ROM chunks
+    uint16_t prg_rom_chunk_size = 0x0000;
+    uint16_t chr_rom_chunk_size = 0x0000;
+
+    switch (file_type) {
+        // iNES 1.0
+        case 1: {
+            prg_rom_chunk_size = 0x4000;
+            chr_rom_chunk_size = 0x2000;
+        }
+        break;
+        // iNES 2.0
+        case 2: {
+
+        }
+        break;
+        // Unsupported file type
+        default: {
+            return false;
+        }
+    }
+
+    layout.prg_rom_size = header.prg_rom_chunks * prg_rom_chunk_size;
+    layout.chr_rom_size = header.chr_rom_chunks * chr_rom_chunk_size;
+    return true;
+}
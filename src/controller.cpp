@@ -28,3 +28,11 @@ uint8_t Controller::popBitFromShiftRegister() {
     shift_register_ <<= 1;
     return bit;
 }
+
+void Controller::saveState(SaveStateWriter& writer) const {
+    writer.write(shift_register_);
+}
+
+void Controller::loadState(SaveStateReader& reader) {
+    reader.read(shift_register_);
+}
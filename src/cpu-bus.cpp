@@ -1,17 +1,75 @@
 #include "cpu-bus.hpp"
 
 CPUBUS::CPUBUS(RP2A03& cpu, MemoryUnit& ram, RP2C02& ppu, const std::unique_ptr<Cartridge>& cartridge): 
-    cpu_(cpu), ram_(ram), ppu_(ppu), cartridge_(cartridge), controllers_({nullptr, nullptr}) {
+    cpu_(cpu), ram_(ram), ppu_(ppu), cartridge_(cartridge), controllers_({nullptr, nullptr}), 
+    read_page_table_(), write_page_table_(), perf_counters_(nullptr) {
+    // Emulate the mirroring of the RAM
+    for (uint16_t page = 0x00; page <= 0x1F; page++) {
+        uint8_t* ram_page = ram_.getPointer() + ((page * CPU_BUS_PAGE_SIZE) % CPU_BUS_RAM_SIZE);
+        read_page_table_.at(page) = ram_page;
+        write_page_table_.at(page) = ram_page;
+    }
+    mapCartridgePages();
+
     cpu_.connectBUS(this);
 }
 
 uint8_t CPUBUS::readBusData(const uint16_t& address) const {
-    // Check if the address is in the range of the RAM
-    if ((0x0000 <= address) && (address <= 0x1FFF)) {
-        // Emulate the mirroring of the RAM
-        return ram_.read(address % CPU_BUS_RAM_SIZE);
+    NES_PERF_COUNT_BUS_ACCESS(perf_counters_, address, false);
+    const uint8_t* page = read_page_table_[address >> 8];
+    if (page) {
+        return page[address & 0x00FF];
     }
-    
+    return readIOData(address);
+}
+
+bool CPUBUS::writeBusData(const uint16_t& address, const uint8_t& data) {
+    NES_PERF_COUNT_BUS_ACCESS(perf_counters_, address, true);
+    uint8_t* page = write_page_table_[address >> 8];
+    if (page) {
+        page[address & 0x00FF] = data;
+        return true;
+    }
+    return writeIOData(address, data);
+}
+
+void CPUBUS::connectPerfCounters(PerfCounters* perf_counters) {
+    perf_counters_ = perf_counters;
+}
+
+bool CPUBUS::connectController(Controller* controller) {
+    if (!controllers_.at(0)) {
+        controllers_.at(0) = controller;
+        return true;
+    }
+    if (!controllers_.at(1)) {
+        controllers_.at(1) = controller;
+        return true;
+    }
+    return false;
+}
+
+void CPUBUS::mapCartridgePages() {
+    for (uint16_t page = 0x60; page <= 0xFF; page++) {
+        // CPU can't write to the cartridge
+        read_page_table_.at(page) = cartridge_ ? cartridge_->getPrgMemPage((page * CPU_BUS_PAGE_SIZE) - 0x6000) : nullptr;
+    }
+}
+
+void CPUBUS::saveState(SaveStateWriter& writer) const {
+    for (const Controller* controller : controllers_) {
+        (controller != nullptr) ? controller->saveState(writer) : Controller().saveState(writer);
+    }
+}
+
+void CPUBUS::loadState(SaveStateReader& reader) {
+    for (Controller* controller : controllers_) {
+        Controller idle_controller;
+        ((controller != nullptr) ? *controller : idle_controller).loadState(reader);
+    }
+}
+
+uint8_t CPUBUS::readIOData(const uint16_t& address) const {
     // Check if the address is in the range of the PPU registers
     if ((0x2000 <= address) && (address <= 0x3FFF)) {
         // Emulate the mirroring of the PPU registers
@@ -49,13 +107,7 @@ uint8_t CPUBUS::readBusData(const uint16_t& address) const {
     return cartridge_->readPrgMem(address - 0x6000);
 }
 
-bool CPUBUS::writeBusData(const uint16_t& address, const uint8_t& data) {
-    // Check if the address is in the range of the RAM
-    if ((0x0000 <= address) && (address <= 0x1FFF)) {
-        // Emulate the mirroring of the RAM
-        return ram_.write(address % CPU_BUS_RAM_SIZE, data);
-    }
-
+bool CPUBUS::writeIOData(const uint16_t& address, const uint8_t& data) {
     // Check if the address is in the range of the PPU registers
     if ((0x2000 <= address) && (address <= 0x3FFF)) {
         // Emulate the mirroring of the PPU registers
@@ -91,15 +143,3 @@ bool CPUBUS::writeBusData(const uint16_t& address, const uint8_t& data) {
     // CPU can't write to the cartridge
     return false;
 }
-
-bool CPUBUS::connectController(Controller* controller) {
-    if (!controllers_.at(0)) {
-        controllers_.at(0) = controller;
-        return true;
-    }
-    if (!controllers_.at(1)) {
-        controllers_.at(1) = controller;
-        return true;
-    }
-    return false;
-}
@@ -1,3 +1,6 @@
+// Standard Library Headers
+#include <fstream>
+#include <string>
 // External Library Headers
 #include <SFML/Window.hpp>
 #include <SFML/Graphics.hpp>
@@ -7,12 +10,32 @@
 #include "nes-sound-sfml.hpp"
 #include "nes.hpp"
 #include "controller.hpp"
+#include "rewind-buffer.hpp"
+#include "trace-recorder.hpp"
 // Debugging Headers
 #ifdef DEBUG
 #include "nes-debug-window.hpp"
 #endif
+// Project Defines
+#define NES_RUN_AHEAD_FRAMES 1
+#define NES_REWIND_SECONDS 60
+#define NES_REWIND_KEYFRAME_INTERVAL NES_WINDOW_FPS
+#define NES_REWIND_BYTE_CAPACITY (4 * 1024 * 1024)
+// Events kept by the trace recorder, about a minute of frames
+#define NES_TRACE_EVENT_CAPACITY (1 << 16)
 
 int main(int argc, char* argv[]) {
+    // --trace <path> records a timeline of the emulation phases, written as Chrome trace JSON when the window closes
+    std::string trace_path;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--trace") {
+            trace_path = argv[i + 1];
+        }
+    }
+    if (!trace_path.empty()) {
+        TraceRecorder::getInstance().start(NES_TRACE_EVENT_CAPACITY);
+    }
+
     NESWindowSFML nes_window;
     sf::RenderWindow& window = nes_window.getWindow();
 
@@ -21,11 +44,19 @@ int main(int argc, char* argv[]) {
     NES nes;
     nes.connectDisplayWindow(nes_window);
     nes.connectSoundSystem(nes_sound);
+    nes.setCatchUpSchedulingEnabled(true);
+    nes.setInstructionSteppingEnabled(true);
+    nes.setScanlineRendererEnabled(true);
+    nes.setRunAheadFrames(NES_RUN_AHEAD_FRAMES);
     nes.loadCartridge("./tests/nestest.nes");
 
     Controller controller_one;
     nes.connectController(controller_one);    
 
+    // Holding R steps the emulation backwards
+    RewindBuffer rewind_buffer(NES_REWIND_SECONDS * NES_WINDOW_FPS, NES_REWIND_KEYFRAME_INTERVAL, NES_REWIND_BYTE_CAPACITY);
+    bool is_rewinding = false;
+
     #ifdef DEBUG
     NESDebugWindow nes_debug_window;
     nes_debug_window.attachNES(&nes);
@@ -34,6 +65,7 @@ int main(int argc, char* argv[]) {
     // run the program as long as the window is open
     while (window.isOpen()) {
         // check all the window's events that were triggered since the last iteration of the loop
+        TraceRecorder::getInstance().record("main::pollEvents", 'B');
         while (const std::optional event = window.pollEvent()) {
             // "close requested" event: we close the window
             if (event->is<sf::Event::Closed>()) {
@@ -71,6 +103,9 @@ int main(int argc, char* argv[]) {
                     case sf::Keyboard::Scancode::Backspace:
                         controller_one.pressButton(Controller::Button::SELECT);
                         break;
+                    case sf::Keyboard::Scancode::R:
+                        is_rewinding = true;
+                        break;
                     default:
                         break;
                 }
@@ -101,6 +136,9 @@ int main(int argc, char* argv[]) {
                     case sf::Keyboard::Scancode::Backspace:
                         controller_one.releaseButton(Controller::Button::SELECT);
                         break;
+                    case sf::Keyboard::Scancode::R:
+                        is_rewinding = false;
+                        break;
                     default:
                         break;
                 }
@@ -121,7 +159,12 @@ int main(int argc, char* argv[]) {
                 window.setSize(sf::Vector2u(new_size.x, new_size.y));
             }
         }
+        TraceRecorder::getInstance().record("main::pollEvents", 'E');
 
+        // A rewound frame is run again from its saved state to display it
+        if (!is_rewinding || !rewind_buffer.popState(nes)) {
+            rewind_buffer.pushState(nes);
+        }
         nes.stepFrame();
         nes_sound.play();
         nes_window.render();
@@ -130,5 +173,11 @@ int main(int argc, char* argv[]) {
         nes_debug_window.update();
         #endif
     }
+
+    if (!trace_path.empty()) {
+        TraceRecorder::getInstance().stop();
+        std::ofstream trace_stream(trace_path);
+        TraceRecorder::getInstance().writeChromeTrace(trace_stream);
+    }
     return 0;
 }
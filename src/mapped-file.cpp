@@ -0,0 +1,63 @@
+#include "mapped-file.hpp"
+// Standard Library Headers
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+std::shared_ptr<const MappedFile> MappedFile::mapFile(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    const int file_descriptor = open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        return nullptr;
+    }
+
+    struct stat file_status;
+    if ((fstat(file_descriptor, &file_status) != 0) || (file_status.st_size <= 0)) {
+        close(file_descriptor);
+        return nullptr;
+    }
+
+    // Pages are only read from the file when they are first touched
+    void* data = mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // The mapping stays valid after the file is closed
+    close(file_descriptor);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::shared_ptr<const MappedFile>(new MappedFile(static_cast<const uint8_t*>(data), file_status.st_size, nullptr));
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open() || (file.tellg() <= 0)) {
+        return nullptr;
+    }
+
+    const uint64_t size = file.tellg();
+    std::unique_ptr<uint8_t[]> read_data = std::make_unique<uint8_t[]>(size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(read_data.get()), size);
+    const uint8_t* data = read_data.get();
+    return std::shared_ptr<const MappedFile>(new MappedFile(data, size, std::move(read_data)));
+#endif
+}
+
+MappedFile::~MappedFile() {
+#if defined(__unix__) || defined(__APPLE__)
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+}
+
+const uint8_t* MappedFile::getData() const {
+    return data_;
+}
+
+uint64_t MappedFile::getSize() const {
+    return size_;
+}
+
+MappedFile::MappedFile(const uint8_t* data, const uint64_t& size, std::unique_ptr<uint8_t[]> read_data): 
+    data_(data), size_(size), read_data_(std::move(read_data)) {}
@@ -15,3 +15,7 @@ std::unique_ptr<Mapper> Mapper::makeMapper(const uint8_t& mapper_id, const uint3
 
 Mapper::Mapper(const uint32_t& prg_ram_size, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size): 
     prg_ram_size_(prg_rom_size), prg_rom_size_(prg_rom_size), chr_rom_size_(chr_rom_size) {}
+
+void Mapper::saveState(SaveStateWriter&) const {}
+
+void Mapper::loadState(SaveStateReader&) {}
@@ -25,3 +25,11 @@ uint8_t* MemoryUnit::getPointer() const {
 uint32_t MemoryUnit::getSize() const {
     return byte_size_;
 }
+
+void MemoryUnit::saveState(SaveStateWriter& writer) const {
+    writer.writeBytes(memory_block_.get(), byte_size_);
+}
+
+void MemoryUnit::loadState(SaveStateReader& reader) {
+    reader.readBytes(memory_block_.get(), byte_size_);
+}
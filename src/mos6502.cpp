@@ -6,74 +6,17 @@
 // Project Headers
 #include "bus.hpp"
 
-// ------------------------ MOS6502 Pointer Class ------------------------------
-
-MOS6502::Pointer::Pointer(MOS6502& cpu, const uint16_t& virtual_address): 
-    cpu_{cpu}, target_location_{std::in_place_type<uint16_t>, virtual_address} {}
-
-MOS6502::Pointer::Pointer(MOS6502& cpu, const MOS6502::Pointer::Register& target_register): 
-    cpu_{cpu}, target_location_{std::in_place_type<MOS6502::Pointer::Register>, target_register} {}
-
-const std::variant<uint16_t, MOS6502::Pointer::Register>& MOS6502::Pointer::get() const {
-    return target_location_;
-}
-
-uint8_t MOS6502::Pointer::read() const {
-    // Holds Virtual Memory Address
-    if (std::holds_alternative<uint16_t>(target_location_)) {
-        return cpu_.readMemory(std::get<uint16_t>(target_location_));
-    }
-    // Holds "Address" for Register
-    switch (std::get<MOS6502::Pointer::Register>(target_location_)) {
-        case MOS6502::Pointer::Register::ACCUMULATOR:
-            return cpu_.accumulator_;
-    }
-}
-
-void MOS6502::Pointer::write(const uint8_t& data) {
-    // Holds Virtual Memory Address
-    if (std::holds_alternative<uint16_t>(target_location_)) {
-        cpu_.writeMemory(std::get<uint16_t>(target_location_), data);
-        return;
-    }
-    // Holds "Address" for Register
-    switch (std::get<MOS6502::Pointer::Register>(target_location_)) {
-        case MOS6502::Pointer::Register::ACCUMULATOR:
-            cpu_.accumulator_ = data;
-    }
-}
-
-void MOS6502::Pointer::operator=(const uint16_t& virtual_address) {
-    target_location_ = virtual_address;
-}
-
-void MOS6502::Pointer::operator=(const MOS6502::Pointer::Register& target_register) {
-    target_location_ = target_register;
-}
-
-MOS6502::Pointer& MOS6502::Pointer::operator++() {
-    return *this += 1;
-}
-
-MOS6502::Pointer& MOS6502::Pointer::operator+=(const int16_t& increment) {
-    // Holds Virtual Memory Address
-    if (std::holds_alternative<uint16_t>(target_location_)) {
-        std::get<uint16_t>(target_location_) += increment;
-    }
-    return *this;
-}
-
 // ----------------------------- MOS6502 Class ---------------------------------
 
 // Thanks to One Lone Coder for the opcode table
-const std::array<MOS6502::Instruction, MOS6502_NUMBER_OF_INSTRUCTIONS> MOS6502::instruction_lookup_table = {{
-    { "BRK", MOS6502::BRK, MOS6502::IMM, 7 },{ "ORA", MOS6502::ORA, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "ORA", MOS6502::ORA, MOS6502::ZP0, 3 },{ "ASL", MOS6502::ASL, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PHP", MOS6502::PHP, MOS6502::IMP, 3 },{ "ORA", MOS6502::ORA, MOS6502::IMM, 2 },{ "ASL", MOS6502::ASL, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ORA", MOS6502::ORA, MOS6502::ABS, 4 },{ "ASL", MOS6502::ASL, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
+constexpr std::array<MOS6502::Instruction, MOS6502_NUMBER_OF_INSTRUCTIONS> MOS6502::instruction_lookup_table = {{
+    { "BRK", MOS6502::BRK, MOS6502::IMM, 7 },{ "ORA", MOS6502::ORA, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "ORA", MOS6502::ORA, MOS6502::ZP0, 3 },{ "ASL", MOS6502::ASL, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PHP", MOS6502::PHP, MOS6502::IMP, 3 },{ "ORA", MOS6502::ORA, MOS6502::IMM, 2 },{ "ASL", MOS6502::ASL_ACC, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ORA", MOS6502::ORA, MOS6502::ABS, 4 },{ "ASL", MOS6502::ASL, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BPL", MOS6502::BPL, MOS6502::REL, 2 },{ "ORA", MOS6502::ORA, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ORA", MOS6502::ORA, MOS6502::ZPX, 4 },{ "ASL", MOS6502::ASL, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "CLC", MOS6502::CLC, MOS6502::IMP, 2 },{ "ORA", MOS6502::ORA, MOS6502::ABY, 4 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ORA", MOS6502::ORA, MOS6502::ABX, 4 },{ "ASL", MOS6502::ASL, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
-    { "JSR", MOS6502::JSR, MOS6502::ABS, 6 },{ "AND", MOS6502::AND, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "BIT", MOS6502::BIT, MOS6502::ZP0, 3 },{ "AND", MOS6502::AND, MOS6502::ZP0, 3 },{ "ROL", MOS6502::ROL, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PLP", MOS6502::PLP, MOS6502::IMP, 4 },{ "AND", MOS6502::AND, MOS6502::IMM, 2 },{ "ROL", MOS6502::ROL, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "BIT", MOS6502::BIT, MOS6502::ABS, 4 },{ "AND", MOS6502::AND, MOS6502::ABS, 4 },{ "ROL", MOS6502::ROL, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
+    { "JSR", MOS6502::JSR, MOS6502::ABS, 6 },{ "AND", MOS6502::AND, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "BIT", MOS6502::BIT, MOS6502::ZP0, 3 },{ "AND", MOS6502::AND, MOS6502::ZP0, 3 },{ "ROL", MOS6502::ROL, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PLP", MOS6502::PLP, MOS6502::IMP, 4 },{ "AND", MOS6502::AND, MOS6502::IMM, 2 },{ "ROL", MOS6502::ROL_ACC, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "BIT", MOS6502::BIT, MOS6502::ABS, 4 },{ "AND", MOS6502::AND, MOS6502::ABS, 4 },{ "ROL", MOS6502::ROL, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BMI", MOS6502::BMI, MOS6502::REL, 2 },{ "AND", MOS6502::AND, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "AND", MOS6502::AND, MOS6502::ZPX, 4 },{ "ROL", MOS6502::ROL, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "SEC", MOS6502::SEC, MOS6502::IMP, 2 },{ "AND", MOS6502::AND, MOS6502::ABY, 4 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "AND", MOS6502::AND, MOS6502::ABX, 4 },{ "ROL", MOS6502::ROL, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
-    { "RTI", MOS6502::RTI, MOS6502::IMP, 6 },{ "EOR", MOS6502::EOR, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "EOR", MOS6502::EOR, MOS6502::ZP0, 3 },{ "LSR", MOS6502::LSR, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PHA", MOS6502::PHA, MOS6502::IMP, 3 },{ "EOR", MOS6502::EOR, MOS6502::IMM, 2 },{ "LSR", MOS6502::LSR, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "JMP", MOS6502::JMP, MOS6502::ABS, 3 },{ "EOR", MOS6502::EOR, MOS6502::ABS, 4 },{ "LSR", MOS6502::LSR, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
+    { "RTI", MOS6502::RTI, MOS6502::IMP, 6 },{ "EOR", MOS6502::EOR, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "EOR", MOS6502::EOR, MOS6502::ZP0, 3 },{ "LSR", MOS6502::LSR, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PHA", MOS6502::PHA, MOS6502::IMP, 3 },{ "EOR", MOS6502::EOR, MOS6502::IMM, 2 },{ "LSR", MOS6502::LSR_ACC, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "JMP", MOS6502::JMP, MOS6502::ABS, 3 },{ "EOR", MOS6502::EOR, MOS6502::ABS, 4 },{ "LSR", MOS6502::LSR, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BVC", MOS6502::BVC, MOS6502::REL, 2 },{ "EOR", MOS6502::EOR, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "EOR", MOS6502::EOR, MOS6502::ZPX, 4 },{ "LSR", MOS6502::LSR, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "CLI", MOS6502::CLI, MOS6502::IMP, 2 },{ "EOR", MOS6502::EOR, MOS6502::ABY, 4 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "EOR", MOS6502::EOR, MOS6502::ABX, 4 },{ "LSR", MOS6502::LSR, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
-    { "RTS", MOS6502::RTS, MOS6502::IMP, 6 },{ "ADC", MOS6502::ADC, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "ADC", MOS6502::ADC, MOS6502::ZP0, 3 },{ "ROR", MOS6502::ROR, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PLA", MOS6502::PLA, MOS6502::IMP, 4 },{ "ADC", MOS6502::ADC, MOS6502::IMM, 2 },{ "ROR", MOS6502::ROR, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "JMP", MOS6502::JMP, MOS6502::IND, 5 },{ "ADC", MOS6502::ADC, MOS6502::ABS, 4 },{ "ROR", MOS6502::ROR, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
+    { "RTS", MOS6502::RTS, MOS6502::IMP, 6 },{ "ADC", MOS6502::ADC, MOS6502::IZX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 3 },{ "ADC", MOS6502::ADC, MOS6502::ZP0, 3 },{ "ROR", MOS6502::ROR, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "PLA", MOS6502::PLA, MOS6502::IMP, 4 },{ "ADC", MOS6502::ADC, MOS6502::IMM, 2 },{ "ROR", MOS6502::ROR_ACC, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "JMP", MOS6502::JMP, MOS6502::IND, 5 },{ "ADC", MOS6502::ADC, MOS6502::ABS, 4 },{ "ROR", MOS6502::ROR, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BVS", MOS6502::BVS, MOS6502::REL, 2 },{ "ADC", MOS6502::ADC, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ADC", MOS6502::ADC, MOS6502::ZPX, 4 },{ "ROR", MOS6502::ROR, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "SEI", MOS6502::SEI, MOS6502::IMP, 2 },{ "ADC", MOS6502::ADC, MOS6502::ABY, 4 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "ADC", MOS6502::ADC, MOS6502::ABX, 4 },{ "ROR", MOS6502::ROR, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
     { "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "STA", MOS6502::STA, MOS6502::IZX, 6 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "STY", MOS6502::STY, MOS6502::ZP0, 3 },{ "STA", MOS6502::STA, MOS6502::ZP0, 3 },{ "STX", MOS6502::STX, MOS6502::ZP0, 3 },{ "???", MOS6502::XXX, MOS6502::IMP, 3 },{ "DEY", MOS6502::DEY, MOS6502::IMP, 2 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "TXA", MOS6502::TXA, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "STY", MOS6502::STY, MOS6502::ABS, 4 },{ "STA", MOS6502::STA, MOS6502::ABS, 4 },{ "STX", MOS6502::STX, MOS6502::ABS, 4 },{ "???", MOS6502::XXX, MOS6502::IMP, 4 },
     { "BCC", MOS6502::BCC, MOS6502::REL, 2 },{ "STA", MOS6502::STA, MOS6502::IZY, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "STY", MOS6502::STY, MOS6502::ZPX, 4 },{ "STA", MOS6502::STA, MOS6502::ZPX, 4 },{ "STX", MOS6502::STX, MOS6502::ZPY, 4 },{ "???", MOS6502::XXX, MOS6502::IMP, 4 },{ "TYA", MOS6502::TYA, MOS6502::IMP, 2 },{ "STA", MOS6502::STA, MOS6502::ABY, 5 },{ "TXS", MOS6502::TXS, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "???", MOS6502::NOP, MOS6502::IMP, 5 },{ "STA", MOS6502::STA, MOS6502::ABX, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },
@@ -81,14 +24,39 @@ const std::array<MOS6502::Instruction, MOS6502_NUMBER_OF_INSTRUCTIONS> MOS6502::
     { "BCS", MOS6502::BCS, MOS6502::REL, 2 },{ "LDA", MOS6502::LDA, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "LDY", MOS6502::LDY, MOS6502::ZPX, 4 },{ "LDA", MOS6502::LDA, MOS6502::ZPX, 4 },{ "LDX", MOS6502::LDX, MOS6502::ZPY, 4 },{ "???", MOS6502::XXX, MOS6502::IMP, 4 },{ "CLV", MOS6502::CLV, MOS6502::IMP, 2 },{ "LDA", MOS6502::LDA, MOS6502::ABY, 4 },{ "TSX", MOS6502::TSX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 4 },{ "LDY", MOS6502::LDY, MOS6502::ABX, 4 },{ "LDA", MOS6502::LDA, MOS6502::ABX, 4 },{ "LDX", MOS6502::LDX, MOS6502::ABY, 4 },{ "???", MOS6502::XXX, MOS6502::IMP, 4 },
     { "CPY", MOS6502::CPY, MOS6502::IMM, 2 },{ "CMP", MOS6502::CMP, MOS6502::IZX, 6 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "CPY", MOS6502::CPY, MOS6502::ZP0, 3 },{ "CMP", MOS6502::CMP, MOS6502::ZP0, 3 },{ "DEC", MOS6502::DEC, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "INY", MOS6502::INY, MOS6502::IMP, 2 },{ "CMP", MOS6502::CMP, MOS6502::IMM, 2 },{ "DEX", MOS6502::DEX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "CPY", MOS6502::CPY, MOS6502::ABS, 4 },{ "CMP", MOS6502::CMP, MOS6502::ABS, 4 },{ "DEC", MOS6502::DEC, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BNE", MOS6502::BNE, MOS6502::REL, 2 },{ "CMP", MOS6502::CMP, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "CMP", MOS6502::CMP, MOS6502::ZPX, 4 },{ "DEC", MOS6502::DEC, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "CLD", MOS6502::CLD, MOS6502::IMP, 2 },{ "CMP", MOS6502::CMP, MOS6502::ABY, 4 },{ "NOP", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "CMP", MOS6502::CMP, MOS6502::ABX, 4 },{ "DEC", MOS6502::DEC, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
-    { "CPX", MOS6502::CPX, MOS6502::IMM, 2 },{ "SBC", MOS6502::SBC, MOS6502::IZX, 6 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "CPX", MOS6502::CPX, MOS6502::ZP0, 3 },{ "SBC", MOS6502::SBC, MOS6502::ZP0, 3 },{ "INC", MOS6502::INC, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "INX", MOS6502::INX, MOS6502::IMP, 2 },{ "SBC", MOS6502::SBC, MOS6502::IMM, 2 },{ "NOP", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::SBC, MOS6502::IMP, 2 },{ "CPX", MOS6502::CPX, MOS6502::ABS, 4 },{ "SBC", MOS6502::SBC, MOS6502::ABS, 4 },{ "INC", MOS6502::INC, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
+    { "CPX", MOS6502::CPX, MOS6502::IMM, 2 },{ "SBC", MOS6502::SBC, MOS6502::IZX, 6 },{ "???", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "CPX", MOS6502::CPX, MOS6502::ZP0, 3 },{ "SBC", MOS6502::SBC, MOS6502::ZP0, 3 },{ "INC", MOS6502::INC, MOS6502::ZP0, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 5 },{ "INX", MOS6502::INX, MOS6502::IMP, 2 },{ "SBC", MOS6502::SBC, MOS6502::IMM, 2 },{ "NOP", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::SBC, MOS6502::IMM, 2 },{ "CPX", MOS6502::CPX, MOS6502::ABS, 4 },{ "SBC", MOS6502::SBC, MOS6502::ABS, 4 },{ "INC", MOS6502::INC, MOS6502::ABS, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },
     { "BEQ", MOS6502::BEQ, MOS6502::REL, 2 },{ "SBC", MOS6502::SBC, MOS6502::IZY, 5 },{ "???", MOS6502::XXX, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 8 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "SBC", MOS6502::SBC, MOS6502::ZPX, 4 },{ "INC", MOS6502::INC, MOS6502::ZPX, 6 },{ "???", MOS6502::XXX, MOS6502::IMP, 6 },{ "SED", MOS6502::SED, MOS6502::IMP, 2 },{ "SBC", MOS6502::SBC, MOS6502::ABY, 4 },{ "NOP", MOS6502::NOP, MOS6502::IMP, 2 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },{ "???", MOS6502::NOP, MOS6502::IMP, 4 },{ "SBC", MOS6502::SBC, MOS6502::ABX, 4 },{ "INC", MOS6502::INC, MOS6502::ABX, 7 },{ "???", MOS6502::XXX, MOS6502::IMP, 7 },
 }};
 
+template<uint8_t (*AddressingMode)(MOS6502& cpu), MOS6502::CycleType (*Operation)(MOS6502& cpu), uint8_t Cycles>
+void MOS6502::executeOpcode(MOS6502& cpu) {
+    cpu.instruction_cycle_remaining_ = Cycles;
+
+    // Getting the additional cycles from the addressing mode
+    uint8_t additional_cycles = AddressingMode(cpu);
+    // Note calling Operation(cpu) can change instruction_cycle_remaining_
+    //   This is only done by branching instructions since their additional cycles are independent of the addressing mode
+    CycleType instruction_cycle_mode = Operation(cpu);
+
+    if (instruction_cycle_mode == CycleType::ACCEPTS_ADDITIONAL_CYCLES) {
+        cpu.instruction_cycle_remaining_ += additional_cycles;
+    }
+}
+
+template<std::size_t... Opcodes>
+constexpr std::array<MOS6502::OpcodeHandler, MOS6502_NUMBER_OF_INSTRUCTIONS> MOS6502::makeOpcodeHandlerTable(std::index_sequence<Opcodes...>) {
+    return {{ &executeOpcode<instruction_lookup_table[Opcodes].addressingMode, 
+                             instruction_lookup_table[Opcodes].operationFn, 
+                             instruction_lookup_table[Opcodes].cycles>... }};
+}
+
+constexpr std::array<MOS6502::OpcodeHandler, MOS6502_NUMBER_OF_INSTRUCTIONS> MOS6502::opcode_handler_table = 
+    MOS6502::makeOpcodeHandlerTable(std::make_index_sequence<MOS6502_NUMBER_OF_INSTRUCTIONS>{});
+
 MOS6502::MOS6502(): bus_(nullptr), program_counter_(MOS6502_STARTING_PC_ADDRESS), stack_ptr_(0), accumulator_(0), 
                     x_reg_(0), y_reg_(0), processor_status_({.RAW_VALUE=0b00110110}),
                     cycles_elapsed_(0), instruction_(nullptr), instruction_opcode_(0x00), 
-                    instruction_cycle_remaining_(0), operand_address_(*this, 0x00), 
+                    instruction_cycle_remaining_(0), operand_address_(0x0000), 
                     relative_addressing_offset_(0) {}
 
 void MOS6502::connectBUS(BUS* target_bus) {
@@ -97,24 +65,16 @@ void MOS6502::connectBUS(BUS* target_bus) {
     reset();
 }
 
-void MOS6502::runInstruction() {
-    instruction_opcode_ = readMemory(program_counter_);
-    program_counter_++;
-
-    instruction_ = &instruction_lookup_table.at(instruction_opcode_);
-    instruction_cycle_remaining_ = instruction_->cycles;
-
-    // Getting the additional cycles from the addressing mode
-    uint8_t additional_cycles = instruction_->addressingMode(*this);
-    // Note calling instruction_->operationFn(*this) can change instruction_cycle_remaining_
-    //   This is only done by branching instructions since their additional cycles are independent of the addressing mode
-    CycleType instruction_cycle_mode = instruction_->operationFn(*this);
-
-    if (instruction_cycle_mode == CycleType::ACCEPTS_ADDITIONAL_CYCLES) {
-        instruction_cycle_remaining_ += additional_cycles;
+uint8_t MOS6502::runInstruction() {
+    // Fetch a new instruction when the current instruction is done
+    if (instruction_cycle_remaining_ == 0) {
+        executeInstruction();
     }
-    
-    cycles_elapsed_ += instruction_cycle_remaining_;
+
+    const uint8_t instruction_cycles = instruction_cycle_remaining_;
+    cycles_elapsed_ += instruction_cycles;
+    instruction_cycle_remaining_ = 0;
+    return instruction_cycles;
 }
 
 void MOS6502::runCycle() {
@@ -122,21 +82,7 @@ void MOS6502::runCycle() {
 
     // Fetch a new instruction when the current instruction is done
     if (instruction_cycle_remaining_ == 0) {
-        instruction_opcode_ = readMemory(program_counter_);
-        program_counter_++;
-
-        instruction_ = &instruction_lookup_table.at(instruction_opcode_);
-        instruction_cycle_remaining_ = instruction_->cycles;
-
-        // Getting the additional cycles from the addressing mode
-        uint8_t additional_cycles = instruction_->addressingMode(*this);
-        // Note calling instruction_->operationFn(*this) can change instruction_cycle_remaining_
-        //   This is only done by branching instructions since their additional cycles are independent of the addressing mode
-        CycleType instruction_cycle_mode = instruction_->operationFn(*this);
-
-        if (instruction_cycle_mode == CycleType::ACCEPTS_ADDITIONAL_CYCLES) {
-            instruction_cycle_remaining_ += additional_cycles;
-        }
+        executeInstruction();
     }
 
     instruction_cycle_remaining_--;
@@ -283,6 +229,15 @@ void MOS6502::nmi() {
 
 // ------------------------ INTERNAL FUNCTIONS ---------------------------------
 
+void MOS6502::executeInstruction() {
+    instruction_opcode_ = readMemory(program_counter_);
+    program_counter_++;
+
+    instruction_ = &instruction_lookup_table[instruction_opcode_];
+    // The handler runs the addressing mode and the operation, and sets the cycles of the instruction
+    opcode_handler_table[instruction_opcode_](*this);
+}
+
 uint64_t MOS6502::getCyclesElapsed() const {
     return cycles_elapsed_;
 }
@@ -300,6 +255,39 @@ void MOS6502::setState(const MOS6502::State& new_state) {
     processor_status_.RAW_VALUE = new_state.processor_status;
 }
 
+void MOS6502::saveState(SaveStateWriter& writer) const {
+    writer.write(program_counter_);
+    writer.write(stack_ptr_);
+    writer.write(accumulator_);
+    writer.write(x_reg_);
+    writer.write(y_reg_);
+    writer.write(processor_status_.RAW_VALUE);
+    writer.write(cycles_elapsed_);
+    // The instruction is saved by its opcode, as it points into the lookup table
+    writer.write(instruction_ != nullptr);
+    writer.write(instruction_opcode_);
+    writer.write(instruction_cycle_remaining_);
+    writer.write(operand_address_);
+    writer.write(relative_addressing_offset_);
+}
+
+void MOS6502::loadState(SaveStateReader& reader) {
+    reader.read(program_counter_);
+    reader.read(stack_ptr_);
+    reader.read(accumulator_);
+    reader.read(x_reg_);
+    reader.read(y_reg_);
+    reader.read(processor_status_.RAW_VALUE);
+    reader.read(cycles_elapsed_);
+    bool has_instruction = false;
+    reader.read(has_instruction);
+    reader.read(instruction_opcode_);
+    instruction_ = has_instruction ? &instruction_lookup_table[instruction_opcode_] : nullptr;
+    reader.read(instruction_cycle_remaining_);
+    reader.read(operand_address_);
+    reader.read(relative_addressing_offset_);
+}
+
 void MOS6502::outputCurrentState(std::ostream &out) const {
     out << std::hex;
     out << "Program Counter: 0x" << program_counter_ << std::endl;
@@ -349,7 +337,7 @@ void MOS6502::stackPush(const uint8_t& data) {
 // ---------------------- INSTRUCTION IMPLEMENTATIONS --------------------------
 
 MOS6502::CycleType MOS6502::ADC(MOS6502& cpu) {
-    uint16_t result = static_cast<uint16_t>(cpu.accumulator_) + static_cast<uint16_t>(cpu.operand_address_.read()) + static_cast<uint16_t>(cpu.getStatusFlag(StatusFlag::CARRY));
+    uint16_t result = static_cast<uint16_t>(cpu.accumulator_) + static_cast<uint16_t>(cpu.readMemory(cpu.operand_address_)) + static_cast<uint16_t>(cpu.getStatusFlag(StatusFlag::CARRY));
 
 	// The carry flag out exists in the high byte bit 0
 	cpu.setStatusFlag(StatusFlag::CARRY, result > 0x00FF);
@@ -358,7 +346,7 @@ MOS6502::CycleType MOS6502::ADC(MOS6502& cpu) {
 	cpu.setStatusFlag(StatusFlag::ZERO, (result & 0x00FF) == 0);
 	
 	// The signed Overflow flag is set based on all that up there! :D
-	cpu.setStatusFlag(StatusFlag::OVERFLOW_FLAG, (~(static_cast<uint16_t>(cpu.accumulator_) ^ static_cast<uint16_t>(cpu.operand_address_.read())) & (static_cast<uint16_t>(cpu.accumulator_) ^ static_cast<uint16_t>(result))) & 0x0080);
+	cpu.setStatusFlag(StatusFlag::OVERFLOW_FLAG, (~(static_cast<uint16_t>(cpu.accumulator_) ^ static_cast<uint16_t>(cpu.readMemory(cpu.operand_address_))) & (static_cast<uint16_t>(cpu.accumulator_) ^ static_cast<uint16_t>(result))) & 0x0080);
 	
 	// The negative flag is set to the most significant bit of the result
 	cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x0080);
@@ -369,20 +357,31 @@ MOS6502::CycleType MOS6502::ADC(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::AND(MOS6502& cpu) {
-    cpu.accumulator_ &= cpu.operand_address_.read();
+    cpu.accumulator_ &= cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.accumulator_ == 0x00);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.accumulator_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::ASL(MOS6502& cpu) {
-    uint8_t result = cpu.operand_address_.read() << 0x01;
+    uint8_t result = cpu.readMemory(cpu.operand_address_) << 0x01;
+
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.readMemory(cpu.operand_address_) & 0x80);
+    cpu.setStatusFlag(StatusFlag::ZERO, result == 0x00);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
+
+    cpu.writeMemory(cpu.operand_address_, result);
+    return CycleType::NO_ADDITIONAL_CYCLES;
+}
+
+MOS6502::CycleType MOS6502::ASL_ACC(MOS6502& cpu) {
+    uint8_t result = cpu.accumulator_ << 0x01;
 
-    cpu.setStatusFlag(StatusFlag::CARRY, cpu.operand_address_.read() & 0x80);
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.accumulator_ & 0x80);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0x00);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
 
-    cpu.operand_address_.write(result);
+    cpu.accumulator_ = result;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -429,10 +428,10 @@ MOS6502::CycleType MOS6502::BEQ(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::BIT(MOS6502& cpu) {
-    uint8_t result = cpu.operand_address_.read() & cpu.accumulator_;
+    uint8_t result = cpu.readMemory(cpu.operand_address_) & cpu.accumulator_;
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0x00);
-    cpu.setStatusFlag(StatusFlag::OVERFLOW_FLAG, cpu.operand_address_.read() & 0x40);
-    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.operand_address_.read() & 0x80);
+    cpu.setStatusFlag(StatusFlag::OVERFLOW_FLAG, cpu.readMemory(cpu.operand_address_) & 0x40);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.readMemory(cpu.operand_address_) & 0x80);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -560,7 +559,7 @@ MOS6502::CycleType MOS6502::CLV(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::CMP(MOS6502& cpu) {
-    int16_t result = cpu.accumulator_ - cpu.operand_address_.read();
+    int16_t result = cpu.accumulator_ - cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::CARRY, result >= 0);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x0080);
@@ -568,7 +567,7 @@ MOS6502::CycleType MOS6502::CMP(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::CPX(MOS6502& cpu) {
-    int16_t result = cpu.x_reg_ - cpu.operand_address_.read();
+    int16_t result = cpu.x_reg_ - cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::CARRY, result >= 0);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x0080);
@@ -576,7 +575,7 @@ MOS6502::CycleType MOS6502::CPX(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::CPY(MOS6502& cpu) {
-    int16_t result = cpu.y_reg_ - cpu.operand_address_.read();
+    int16_t result = cpu.y_reg_ - cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::CARRY, result >= 0);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x0080);
@@ -584,9 +583,9 @@ MOS6502::CycleType MOS6502::CPY(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::DEC(MOS6502& cpu) {
-    cpu.operand_address_.write(cpu.operand_address_.read() - 1);
-    cpu.setStatusFlag(StatusFlag::ZERO, cpu.operand_address_.read() == 0);
-    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.operand_address_.read() & 0x80);
+    cpu.writeMemory(cpu.operand_address_, cpu.readMemory(cpu.operand_address_) - 1);
+    cpu.setStatusFlag(StatusFlag::ZERO, cpu.readMemory(cpu.operand_address_) == 0);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.readMemory(cpu.operand_address_) & 0x80);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -605,16 +604,16 @@ MOS6502::CycleType MOS6502::DEY(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::EOR(MOS6502& cpu) {
-    cpu.accumulator_ ^= cpu.operand_address_.read();
+    cpu.accumulator_ ^= cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.accumulator_ == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.accumulator_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::INC(MOS6502& cpu) {
-    cpu.operand_address_.write(cpu.operand_address_.read() + 1);
-    cpu.setStatusFlag(StatusFlag::ZERO, cpu.operand_address_.read() == 0);
-    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.operand_address_.read() & 0x80);
+    cpu.writeMemory(cpu.operand_address_, cpu.readMemory(cpu.operand_address_) + 1);
+    cpu.setStatusFlag(StatusFlag::ZERO, cpu.readMemory(cpu.operand_address_) == 0);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.readMemory(cpu.operand_address_) & 0x80);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -633,53 +632,56 @@ MOS6502::CycleType MOS6502::INY(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::JMP(MOS6502& cpu) {
-    const std::variant<uint16_t, MOS6502::Pointer::Register>& jump_location = cpu.operand_address_.get();
-    if (std::holds_alternative<uint16_t>(jump_location)) {
-        cpu.program_counter_ = std::get<uint16_t>(jump_location);
-    }
+    cpu.program_counter_ = cpu.operand_address_;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::JSR(MOS6502& cpu) {
-    const std::variant<uint16_t, MOS6502::Pointer::Register>& jump_location = cpu.operand_address_.get();
-    if (std::holds_alternative<uint16_t>(jump_location)) {
-        uint16_t return_address = cpu.program_counter_ - 1;
-        uint8_t return_address_high_byte = (return_address & 0xFF00) >> 8;
-        uint8_t return_address_low_byte = return_address & 0x00FF;
-        cpu.stackPush(return_address_high_byte);
-        cpu.stackPush(return_address_low_byte);
-        cpu.program_counter_ = std::get<uint16_t>(jump_location);
-    }
+    uint16_t return_address = cpu.program_counter_ - 1;
+    uint8_t return_address_high_byte = (return_address & 0xFF00) >> 8;
+    uint8_t return_address_low_byte = return_address & 0x00FF;
+    cpu.stackPush(return_address_high_byte);
+    cpu.stackPush(return_address_low_byte);
+    cpu.program_counter_ = cpu.operand_address_;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::LDA(MOS6502& cpu) {
-    cpu.accumulator_ = cpu.operand_address_.read();
+    cpu.accumulator_ = cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.accumulator_ == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.accumulator_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::LDX(MOS6502& cpu) {
-    cpu.x_reg_ = cpu.operand_address_.read();
+    cpu.x_reg_ = cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.x_reg_ == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.x_reg_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::LDY(MOS6502& cpu) {
-    cpu.y_reg_ = cpu.operand_address_.read();
+    cpu.y_reg_ = cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.y_reg_ == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.y_reg_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::LSR(MOS6502& cpu) {
-    uint8_t result = cpu.operand_address_.read() >> 1;
-    cpu.setStatusFlag(StatusFlag::CARRY, cpu.operand_address_.read() & 0x01);
+    uint8_t result = cpu.readMemory(cpu.operand_address_) >> 1;
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.readMemory(cpu.operand_address_) & 0x01);
+    cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
+    cpu.writeMemory(cpu.operand_address_, result);
+    return CycleType::NO_ADDITIONAL_CYCLES;
+}
+
+MOS6502::CycleType MOS6502::LSR_ACC(MOS6502& cpu) {
+    uint8_t result = cpu.accumulator_ >> 1;
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.accumulator_ & 0x01);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
-    cpu.operand_address_.write(result);
+    cpu.accumulator_ = result;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -688,7 +690,7 @@ MOS6502::CycleType MOS6502::NOP(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::ORA(MOS6502& cpu) {
-    cpu.accumulator_ |= cpu.operand_address_.read();
+    cpu.accumulator_ |= cpu.readMemory(cpu.operand_address_);
     cpu.setStatusFlag(StatusFlag::ZERO, cpu.accumulator_ == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, cpu.accumulator_ & 0x80);
     return CycleType::ACCEPTS_ADDITIONAL_CYCLES;
@@ -723,20 +725,38 @@ MOS6502::CycleType MOS6502::PLP(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::ROL(MOS6502& cpu) {
-    uint8_t result = (cpu.operand_address_.read() << 1) | cpu.getStatusFlag(StatusFlag::CARRY);
-    cpu.setStatusFlag(StatusFlag::CARRY, cpu.operand_address_.read() & 0x80);
+    uint8_t result = (cpu.readMemory(cpu.operand_address_) << 1) | cpu.getStatusFlag(StatusFlag::CARRY);
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.readMemory(cpu.operand_address_) & 0x80);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
-    cpu.operand_address_.write(result);
+    cpu.writeMemory(cpu.operand_address_, result);
+    return CycleType::NO_ADDITIONAL_CYCLES;
+}
+
+MOS6502::CycleType MOS6502::ROL_ACC(MOS6502& cpu) {
+    uint8_t result = (cpu.accumulator_ << 1) | cpu.getStatusFlag(StatusFlag::CARRY);
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.accumulator_ & 0x80);
+    cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
+    cpu.accumulator_ = result;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::ROR(MOS6502& cpu) {
-    uint8_t result = (cpu.operand_address_.read() >> 1) | (cpu.getStatusFlag(StatusFlag::CARRY) << 7);
-    cpu.setStatusFlag(StatusFlag::CARRY, cpu.operand_address_.read() & 0x01);
+    uint8_t result = (cpu.readMemory(cpu.operand_address_) >> 1) | (cpu.getStatusFlag(StatusFlag::CARRY) << 7);
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.readMemory(cpu.operand_address_) & 0x01);
+    cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
+    cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
+    cpu.writeMemory(cpu.operand_address_, result);
+    return CycleType::NO_ADDITIONAL_CYCLES;
+}
+
+MOS6502::CycleType MOS6502::ROR_ACC(MOS6502& cpu) {
+    uint8_t result = (cpu.accumulator_ >> 1) | (cpu.getStatusFlag(StatusFlag::CARRY) << 7);
+    cpu.setStatusFlag(StatusFlag::CARRY, cpu.accumulator_ & 0x01);
     cpu.setStatusFlag(StatusFlag::ZERO, result == 0);
     cpu.setStatusFlag(StatusFlag::NEGATIVE, result & 0x80);
-    cpu.operand_address_.write(result);
+    cpu.accumulator_ = result;
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -767,7 +787,7 @@ MOS6502::CycleType MOS6502::SBC(MOS6502& cpu) {
 	// Operating in 16-bit domain to capture carry out
 	
 	// We can invert the bottom 8 bits with bitwise xor
-	uint16_t inverted_operand = static_cast<uint16_t>(cpu.operand_address_.read()) ^ 0x00FF;
+	uint16_t inverted_operand = static_cast<uint16_t>(cpu.readMemory(cpu.operand_address_)) ^ 0x00FF;
 	// Notice this is exactly the same as addition from here!
 	uint16_t result = static_cast<uint16_t>(cpu.accumulator_) + inverted_operand + static_cast<uint16_t>(cpu.getStatusFlag(StatusFlag::CARRY));
 	
@@ -796,17 +816,17 @@ MOS6502::CycleType MOS6502::SEI(MOS6502& cpu) {
 }
 
 MOS6502::CycleType MOS6502::STA(MOS6502& cpu) {
-    cpu.operand_address_.write(cpu.accumulator_);
+    cpu.writeMemory(cpu.operand_address_, cpu.accumulator_);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::STX(MOS6502& cpu) {
-    cpu.operand_address_.write(cpu.x_reg_);
+    cpu.writeMemory(cpu.operand_address_, cpu.x_reg_);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
 MOS6502::CycleType MOS6502::STY(MOS6502& cpu) {
-    cpu.operand_address_.write(cpu.y_reg_);
+    cpu.writeMemory(cpu.operand_address_, cpu.y_reg_);
     return CycleType::NO_ADDITIONAL_CYCLES;
 }
 
@@ -857,8 +877,8 @@ MOS6502::CycleType MOS6502::XXX(MOS6502& cpu) {
 
 // -------------------- ADDRESSING MODE IMPLEMENTATIONS ------------------------
 
-uint8_t MOS6502::IMP(MOS6502& cpu) {
-    cpu.operand_address_ = Pointer::Register::ACCUMULATOR;
+uint8_t MOS6502::IMP(MOS6502&) {
+    // Accumulator operands are handled by the _ACC instructions
     return 0;
 }
 
@@ -912,7 +932,7 @@ uint8_t MOS6502::ABX(MOS6502& cpu) {
     cpu.operand_address_ = ((address_high_byte << 8) | address_low_byte) + cpu.x_reg_;
 
     // If page crossed, add 1 more cycle
-    if ((std::get<uint16_t>(cpu.operand_address_.get()) & 0xFF00) != (address_high_byte << 8)) {
+    if ((cpu.operand_address_ & 0xFF00) != (address_high_byte << 8)) {
         return 1;
     }
     return 0;
@@ -927,7 +947,7 @@ uint8_t MOS6502::ABY(MOS6502& cpu) {
     cpu.operand_address_ = ((address_high_byte << 8) | address_low_byte) + cpu.y_reg_;
     
     // If page crossed, add 1 more cycle
-    if ((std::get<uint16_t>(cpu.operand_address_.get()) & 0xFF00) != (address_high_byte << 8)) {
+    if ((cpu.operand_address_ & 0xFF00) != (address_high_byte << 8)) {
         return 1;
     }
     return 0;
@@ -0,0 +1,478 @@
+// Standard Library Headers
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+// Project Headers
+#include "apu.hpp"
+#include "cartridge.hpp"
+#include "controller.hpp"
+#include "cpu-bus.hpp"
+#include "memory-unit.hpp"
+#include "nes.hpp"
+#include "nes-sound-null.hpp"
+#include "nes-window-null.hpp"
+#include "ppu-bus.hpp"
+#include "rp2A03.hpp"
+#include "rp2C02.hpp"
+// Project Defines
+// Version of the output format, bumped when a benchmark or a metric is renamed
+#define NES_BENCH_FORMAT_VERSION 1
+#define NES_BENCH_DEFAULT_FRAMES 600
+#define NES_BENCH_CPU_INSTRUCTIONS 4000000
+#define NES_BENCH_BUS_READS 16000000
+#define NES_BENCH_PPU_FRAMES 120
+#define NES_BENCH_APU_CYCLES 8000000
+// Address of the subroutine the CPU benchmarks call, and of the interrupt handler
+#define NES_BENCH_SUBROUTINE_ADDRESS 0xBFF0
+#define NES_BENCH_INTERRUPT_ADDRESS 0xBFF1
+
+// Every allocation made by the program, including the ones made by the emulation core
+static std::atomic<uint64_t> s_allocation_count{0};
+
+void* operator new(std::size_t size) {
+    s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc((size > 0) ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+// Keeps the result of a benchmark loop alive, so the compiler can't remove the loop
+static volatile uint32_t s_sink = 0;
+
+using Clock = std::chrono::steady_clock;
+using Metrics = std::vector<std::pair<std::string, double>>;
+
+/**
+* @brief  Prints the result of a benchmark as one line of JSON, so results can be parsed and compared across commits
+* @param  name: Name of the benchmark, stable across commits
+* @param  metrics: Name and value of each metric
+* @return None
+*/
+static void printResult(const std::string& name, const Metrics& metrics) {
+    std::cout << "{\"name\":\"" << name << "\"";
+    for (const auto& [metric, value] : metrics) {
+        // Counts are printed as integers, the rest with a fixed precision
+        std::cout << ",\"" << metric << "\":" << std::fixed << std::setprecision((value == std::floor(value)) ? 0 : 3) << value;
+    }
+    std::cout << "}" << std::endl;
+}
+
+/**
+* @brief  Gets the nanoseconds elapsed since a time
+* @param  start_time: The time to measure from
+* @return Nanoseconds elapsed
+*/
+static double getNanosecondsSince(const Clock::time_point& start_time) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start_time).count();
+}
+
+/**
+* @brief  Builds an iNES image of a mapper 000 cartridge with 16KB of PRG ROM and 8KB of CHR ROM
+*   The PRG ROM starts with the program, its interrupt handler is an RTI and the subroutine is an RTS
+* @param  program: Code run from $8000 on reset
+* @param  nmi_address: Address of the NMI handler
+* @return The iNES image
+*/
+static std::string makeRom(const std::vector<uint8_t>& program, const uint16_t& nmi_address) {
+    std::string rom(16 + 0x4000 + 0x2000, '\0');
+    rom.replace(0, 6, std::string("NES\x1A\x01\x01", 6));
+
+    // The PRG ROM is mirrored at $8000 and $C000
+    char* prg_rom = rom.data() + 16;
+    std::copy(program.begin(), program.end(), prg_rom);
+    prg_rom[NES_BENCH_SUBROUTINE_ADDRESS & 0x3FFF] = static_cast<char>(0x60); // RTS
+    prg_rom[NES_BENCH_INTERRUPT_ADDRESS & 0x3FFF] = static_cast<char>(0x40); // RTI
+    const std::array<uint16_t, 3> vectors = {nmi_address, 0x8000, NES_BENCH_INTERRUPT_ADDRESS};
+    for (uint8_t i = 0; i < vectors.size(); i++) {
+        prg_rom[0x3FFA + (i * 2)] = static_cast<char>(vectors[i] & 0xFF);
+        prg_rom[0x3FFB + (i * 2)] = static_cast<char>(vectors[i] >> 8);
+    }
+
+    // Tiles with every colour, so the PPU draws something
+    char* chr_rom = prg_rom + 0x4000;
+    for (uint16_t i = 0; i < 0x2000; i++) {
+        chr_rom[i] = static_cast<char>(i * 37);
+    }
+    return rom;
+}
+
+/**
+* @brief  Builds a ROM that runs a block of code over and over, to time a class of instructions
+* @param  block: The code, which must leave the CPU at the next byte after it
+* @return The iNES image
+*/
+static std::string makeInstructionRom(const std::vector<uint8_t>& block) {
+    std::vector<uint8_t> program;
+    const uint16_t program_size = (NES_BENCH_SUBROUTINE_ADDRESS & 0x3FFF) - 3;
+    while (program.size() + block.size() <= program_size) {
+        program.insert(program.end(), block.begin(), block.end());
+    }
+    // JMP $8000
+    program.insert(program.end(), {0x4C, 0x00, 0x80});
+    return makeRom(program, NES_BENCH_INTERRUPT_ADDRESS);
+}
+
+/**
+* @brief  Builds a ROM that plays like a game: rendering and sound are on, the main loop keeps the CPU busy
+*   and the NMI handler runs an OAM DMA transfer, sets the scroll and changes the pitch every frame
+* @param  None
+* @return The iNES image
+*/
+static std::string makeGameRom() {
+    std::vector<uint8_t> program = {
+        0x78,             // SEI
+        0xD8,             // CLD
+        0xA2, 0xFF,       // LDX #$FF
+        0x9A,             // TXS
+        0xAD, 0x02, 0x20, // LDA $2002
+        0xA9, 0x3F,       // LDA #$3F
+        0x8D, 0x06, 0x20, // STA $2006
+        0xA9, 0x00,       // LDA #$00
+        0x8D, 0x06, 0x20, // STA $2006, palette address
+        0xA2, 0x00,       // LDX #$00
+        0x8A,             // TXA
+        0x8D, 0x07, 0x20, // STA $2007
+        0xE8,             // INX
+        0xE0, 0x20,       // CPX #$20
+        0xD0, 0xF7,       // BNE -9, a different colour in every palette entry
+        0xA9, 0x80,       // LDA #$80
+        0x8D, 0x00, 0x20, // STA $2000, NMI on VBlank
+        0xA9, 0x1E,       // LDA #$1E
+        0x8D, 0x01, 0x20, // STA $2001, background and sprites on
+        0xA9, 0x0F,       // LDA #$0F
+        0x8D, 0x15, 0x40, // STA $4015
+        0xA9, 0xBF,       // LDA #$BF
+        0x8D, 0x00, 0x40, // STA $4000, constant volume pulse
+        0xA9, 0xFE,       // LDA #$FE
+        0x8D, 0x02, 0x40, // STA $4002
+        0xA9, 0x00,       // LDA #$00
+        0x8D, 0x03, 0x40, // STA $4003
+    };
+
+    // Moves the sprites around
+    const uint16_t main_loop_address = 0x8000 + program.size();
+    program.insert(program.end(), {
+        0xE6, 0x00,       // INC $00
+        0xA5, 0x00,       // LDA $00
+        0x65, 0x01,       // ADC $01
+        0x9D, 0x00, 0x02, // STA $0200,X
+        0xE8,             // INX
+        0x4C, static_cast<uint8_t>(main_loop_address & 0xFF), static_cast<uint8_t>(main_loop_address >> 8),
+    });
+
+    const uint16_t nmi_address = 0x8000 + program.size();
+    program.insert(program.end(), {
+        0x48,             // PHA
+        0xA9, 0x02,       // LDA #$02
+        0x8D, 0x14, 0x40, // STA $4014, OAM DMA from $0200
+        0xAD, 0x02, 0x20, // LDA $2002
+        0xA9, 0x00,       // LDA #$00
+        0x8D, 0x05, 0x20, // STA $2005
+        0x8D, 0x05, 0x20, // STA $2005
+        0xA5, 0x00,       // LDA $00
+        0x8D, 0x02, 0x40, // STA $4002
+        0x68,             // PLA
+        0x40,             // RTI
+    });
+    return makeRom(program, nmi_address);
+}
+
+// The components of the NES wired together like in the NES class, so each one can be run on its own
+struct BenchSystem {
+    explicit BenchSystem(const std::string& rom);
+    // Members
+    RP2A03 cpu;
+    MemoryUnit ram;
+    RP2C02 ppu;
+    MemoryUnit vram;
+    std::unique_ptr<Cartridge> cartridge;
+    CPUBUS cpu_bus;
+    PPUBUS ppu_bus;
+};
+
+BenchSystem::BenchSystem(const std::string& rom):
+    cpu(), ram(CPU_BUS_RAM_SIZE), ppu(), vram(PPU_BUS_NAME_TABLE_SIZE),
+    cartridge([&rom]() {
+        std::istringstream rom_data_stream(rom);
+        return Cartridge::makeCartridge(rom_data_stream);
+    }()),
+    cpu_bus(cpu, ram, ppu, cartridge), ppu_bus(ppu, vram, cartridge) {
+    cpu_bus.mapCartridgePages();
+    ppu_bus.mapMemoryPages();
+    cpu.reset();
+}
+
+/**
+* @brief  Times MOS6502::runInstruction on each class of instructions
+* @param  None
+* @return None
+*/
+static void benchCPU() {
+    const std::vector<std::pair<std::string, std::vector<uint8_t>>> instruction_classes = {
+        // INX, INY, DEX, DEY
+        {"implied", {0xE8, 0xC8, 0xCA, 0x88}},
+        // LDA $00, STA $01, LDX $02, STY $03
+        {"load_store", {0xA5, 0x00, 0x85, 0x01, 0xA6, 0x02, 0x84, 0x03}},
+        // ADC #$01, AND #$FF, EOR #$55, CMP #$10
+        {"arithmetic", {0x69, 0x01, 0x29, 0xFF, 0x49, 0x55, 0xC9, 0x10}},
+        // INC $00, LSR $01
+        {"read_modify_write", {0xE6, 0x00, 0x46, 0x01}},
+        // LDA $0300,X, LDA ($10),Y
+        {"indexed", {0xBD, 0x00, 0x03, 0xB1, 0x10}},
+        // CLC, BCC +0
+        {"branch", {0x18, 0x90, 0x00}},
+        // PHA, PLA
+        {"stack", {0x48, 0x68}},
+        // JSR to an RTS
+        {"subroutine", {0x20, NES_BENCH_SUBROUTINE_ADDRESS & 0xFF, NES_BENCH_SUBROUTINE_ADDRESS >> 8}},
+    };
+
+    for (const auto& [name, block] : instruction_classes) {
+        BenchSystem system(makeInstructionRom(block));
+        MOS6502& cpu = system.cpu;
+
+        uint64_t cycle_count = 0;
+        const uint64_t start_allocation_count = s_allocation_count;
+        const Clock::time_point start_time = Clock::now();
+        for (uint32_t i = 0; i < NES_BENCH_CPU_INSTRUCTIONS; i++) {
+            cycle_count += cpu.runInstruction();
+        }
+        const double elapsed_ns = getNanosecondsSince(start_time);
+        const uint64_t allocation_count = s_allocation_count - start_allocation_count;
+
+        printResult("cpu.run_instruction." + name, {
+            {"ns_per_instruction", elapsed_ns / NES_BENCH_CPU_INSTRUCTIONS},
+            {"ns_per_cycle", elapsed_ns / cycle_count},
+            {"allocations", static_cast<double>(allocation_count)},
+        });
+    }
+}
+
+/**
+* @brief  Times CPUBUS::readBusData and PPUBUS::readBusData on each kind of memory behind them
+* @param  None
+* @return None
+*/
+static void benchBuses() {
+    BenchSystem system(makeGameRom());
+    const BUS& cpu_bus = system.cpu_bus;
+    const BUS& ppu_bus = system.ppu_bus;
+
+    // Bus, first address and address mask of each kind of memory
+    const std::vector<std::tuple<std::string, const BUS*, uint16_t, uint16_t>> regions = {
+        {"cpu_bus.read.ram", &cpu_bus, 0x0000, 0x07FF},
+        {"cpu_bus.read.prg_rom", &cpu_bus, 0x8000, 0x7FFF},
+        {"ppu_bus.read.pattern_table", &ppu_bus, 0x0000, 0x1FFF},
+        {"ppu_bus.read.name_table", &ppu_bus, 0x2000, 0x0FFF},
+    };
+
+    for (const auto& [name, bus, base_address, address_mask] : regions) {
+        uint32_t sum = 0;
+        const uint64_t start_allocation_count = s_allocation_count;
+        const Clock::time_point start_time = Clock::now();
+        for (uint32_t i = 0; i < NES_BENCH_BUS_READS; i++) {
+            sum += bus->readBusData(base_address + ((i * 7) & address_mask));
+        }
+        const double elapsed_ns = getNanosecondsSince(start_time);
+        const uint64_t allocation_count = s_allocation_count - start_allocation_count;
+        s_sink = s_sink + sum;
+
+        printResult(name, {
+            {"ns_per_read", elapsed_ns / NES_BENCH_BUS_READS},
+            {"allocations", static_cast<double>(allocation_count)},
+        });
+    }
+}
+
+/**
+* @brief  Times RP2C02::runCycle on each type of scanline, with rendering on, for both renderers
+* @param  None
+* @return None
+*/
+static void benchPPU() {
+    enum ScanlineType : uint8_t {
+        VISIBLE = 0,
+        POST_RENDER = 1,
+        VBLANK = 2,
+        PRE_RENDER = 3,
+        COUNT = 4,
+    };
+    const std::array<std::string, ScanlineType::COUNT> scanline_type_names = {"visible", "post_render", "vblank", "pre_render"};
+
+    for (const bool is_scanline_renderer_enabled : {false, true}) {
+        BenchSystem system(makeGameRom());
+        RP2C02& ppu = system.ppu;
+        ppu.setScanlineRendererEnabled(is_scanline_renderer_enabled);
+        // Background and sprites on
+        system.cpu_bus.writeBusData(0x2001, 0x1E);
+
+        std::array<double, ScanlineType::COUNT> elapsed_ns = {};
+        std::array<uint64_t, ScanlineType::COUNT> cycle_count = {};
+        const uint64_t start_allocation_count = s_allocation_count;
+        for (uint32_t frame = 0; frame < NES_BENCH_PPU_FRAMES; frame++) {
+            // The PPU starts at scanline 0, the pre-render scanline is the last of each frame
+            for (int16_t scanline = 0; scanline <= 261; scanline++) {
+                const ScanlineType type = (scanline <= 239) ? VISIBLE : (scanline == 240) ? POST_RENDER : (scanline <= 260) ? VBLANK : PRE_RENDER;
+
+                const Clock::time_point start_time = Clock::now();
+                for (uint16_t cycle = 0; cycle < RP2C02_CYCLES_PER_SCANLINE; cycle++) {
+                    ppu.runCycle();
+                }
+                elapsed_ns[type] += getNanosecondsSince(start_time);
+                cycle_count[type] += RP2C02_CYCLES_PER_SCANLINE;
+            }
+        }
+        const uint64_t allocation_count = s_allocation_count - start_allocation_count;
+
+        const std::string renderer_name = is_scanline_renderer_enabled ? "scanline_renderer" : "dot_renderer";
+        for (uint8_t type = 0; type < ScanlineType::COUNT; type++) {
+            printResult("ppu.run_cycle." + scanline_type_names[type] + "." + renderer_name, {
+                {"ns_per_cycle", elapsed_ns[type] / cycle_count[type]},
+                {"allocations", static_cast<double>(allocation_count)},
+            });
+        }
+    }
+}
+
+/**
+* @brief  Times APU::clockAPU with the pulse and triangle channels playing into a Sound System
+* @param  None
+* @return None
+*/
+static void benchAPU() {
+    NESSoundNull sound_system;
+    APU apu;
+    apu.connectSoundSystem(sound_system);
+
+    // Constant volume pulses with different duties and periods, and a triangle
+    const std::vector<std::pair<uint8_t, uint8_t>> register_writes = {
+        {0x15, 0x0F},
+        {0x00, 0xBF}, {0x02, 0xFE}, {0x03, 0x00},
+        {0x04, 0x7F}, {0x06, 0x53}, {0x07, 0x01},
+        {0x08, 0xFF}, {0x0A, 0x80}, {0x0B, 0x00},
+    };
+    for (const auto& [address, data] : register_writes) {
+        apu.writeAPURegister(address, data);
+    }
+
+    const uint64_t start_allocation_count = s_allocation_count;
+    const Clock::time_point start_time = Clock::now();
+    for (uint32_t i = 0; i < NES_BENCH_APU_CYCLES; i++) {
+        apu.clockAPU();
+    }
+    apu.endAudioFrame();
+    const double elapsed_ns = getNanosecondsSince(start_time);
+    const uint64_t allocation_count = s_allocation_count - start_allocation_count;
+
+    printResult("apu.clock_apu", {
+        {"ns_per_cycle", elapsed_ns / NES_BENCH_APU_CYCLES},
+        {"allocations", static_cast<double>(allocation_count)},
+    });
+}
+
+/**
+* @brief  Runs frames of a ROM headless, with the reference scheduling and with the fastest one
+* @param  name: Name of the ROM in the results
+* @param  rom_data: The iNES image, used when rom_path is empty
+* @param  rom_path: Path to the ROM file
+* @param  frames: Number of frames to run
+* @return None
+*/
+static void benchFrames(const std::string& name, const std::string& rom_data, const std::string& rom_path, const uint64_t& frames) {
+    for (const bool is_fast_scheduling_enabled : {false, true}) {
+        NESWindowNull nes_window;
+        NESSoundNull nes_sound;
+        Controller controller_one;
+
+        NES nes;
+        nes.connectDisplayWindow(nes_window);
+        nes.connectSoundSystem(nes_sound);
+        nes.setCatchUpSchedulingEnabled(is_fast_scheduling_enabled);
+        nes.setInstructionSteppingEnabled(is_fast_scheduling_enabled);
+        nes.setScanlineRendererEnabled(is_fast_scheduling_enabled);
+        if (rom_path.empty()) {
+            std::istringstream rom_data_stream(rom_data);
+            nes.loadCartridge(rom_data_stream);
+        }
+        else {
+            nes.loadCartridge(rom_path);
+        }
+        nes.connectController(controller_one);
+
+        uint64_t clock_count = 0;
+        const uint64_t start_allocation_count = s_allocation_count;
+        const Clock::time_point start_time = Clock::now();
+        for (uint64_t frame = 0; frame < frames; frame++) {
+            clock_count += nes.stepFrame();
+            nes_sound.play();
+            nes_window.render();
+        }
+        const double elapsed_seconds = getNanosecondsSince(start_time) / 1e9;
+        const uint64_t allocation_count = s_allocation_count - start_allocation_count;
+
+        const std::string scheduling_name = is_fast_scheduling_enabled ? "catch_up" : "interleaved";
+        printResult("frames." + name + "." + scheduling_name, {
+            {"frames", static_cast<double>(frames)},
+            {"frames_per_second", frames / elapsed_seconds},
+            {"master_clocks_per_second", clock_count / elapsed_seconds},
+            {"allocations_per_frame", static_cast<double>(allocation_count) / frames},
+        });
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if ((argc > 1) && (std::string(argv[1]) == "--help")) {
+        std::cerr << "Usage: " << argv[0] << " [frames] [rom path...]" << std::endl;
+        return 1;
+    }
+    const uint64_t frames_to_run = (argc > 1) ? std::stoull(argv[1]) : NES_BENCH_DEFAULT_FRAMES;
+
+    printResult("nes-bench", {{"format_version", NES_BENCH_FORMAT_VERSION}});
+
+    // Micro-benchmarks
+    benchCPU();
+    benchBuses();
+    benchPPU();
+    benchAPU();
+
+    // Macro-benchmarks, on the built-in ROM then on every ROM given
+    benchFrames("builtin", makeGameRom(), "", frames_to_run);
+    for (int i = 2; i < argc; i++) {
+        const std::string rom_path = argv[i];
+        benchFrames(rom_path.substr(rom_path.find_last_of('/') + 1), "", rom_path, frames_to_run);
+    }
+    return 0;
+}
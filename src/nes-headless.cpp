@@ -0,0 +1,67 @@
+// Standard Library Headers
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+// Project Headers
+#include "nes-window-null.hpp"
+#include "nes-sound-null.hpp"
+#include "nes.hpp"
+#include "controller.hpp"
+// Project Defines
+#define NES_HEADLESS_DEFAULT_FRAMES 600
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <rom path> [frames] [performance counters csv path]" << std::endl;
+        return 1;
+    }
+
+    const std::string rom_path = argv[1];
+    const uint64_t frames_to_run = (argc > 2) ? std::stoull(argv[2]) : NES_HEADLESS_DEFAULT_FRAMES;
+
+    NESWindowNull nes_window;
+    NESSoundNull nes_sound;
+
+    NES nes;
+    nes.connectDisplayWindow(nes_window);
+    nes.connectSoundSystem(nes_sound);
+    nes.setCatchUpSchedulingEnabled(true);
+    nes.setInstructionSteppingEnabled(true);
+    nes.setScanlineRendererEnabled(true);
+    nes.loadCartridge(rom_path);
+
+    Controller controller_one;
+    nes.connectController(controller_one);
+
+    // The counters of every frame, only recorded when built with -DNES_PERF_COUNTERS
+    std::ofstream perf_counters_stream;
+    if (argc > 3) {
+        perf_counters_stream.open(argv[3]);
+        nes.setPerfCountersDumpStream(&perf_counters_stream);
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t frame = 0; frame < frames_to_run; frame++) {
+        nes.stepFrame();
+        nes_sound.play();
+        nes_window.render();
+    }
+    const auto end_time = std::chrono::steady_clock::now();
+
+    const double elapsed_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    std::cout << "Frames : " << frames_to_run << std::endl;
+    std::cout << "Seconds: " << elapsed_seconds << std::endl;
+    std::cout << "FPS    : " << (elapsed_seconds > 0 ? frames_to_run / elapsed_seconds : 0) << std::endl;
+
+    const PerfCounters::Snapshot perf_counters = nes.getPerfCounters();
+    if (perf_counters.frame_count > 0) {
+        const std::array<const char*, 4> subsystem_names = {"System", "CPU   ", "PPU   ", "APU   "};
+        for (uint8_t i = 0; i < subsystem_names.size(); i++) {
+            std::cout << subsystem_names[i] << ": " << perf_counters.total.subsystem_ticks[i] / perf_counters.frame_count << " ticks/frame" << std::endl;
+        }
+    }
+    return 0;
+}
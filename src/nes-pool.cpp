@@ -0,0 +1,187 @@
+#include "nes-pool.hpp"
+// Standard Library Headers
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+NESPool::Instance::Instance(const uint32_t& sound_buffer_size): sound(sound_buffer_size) {
+    nes.connectDisplayWindow(window);
+    nes.connectSoundSystem(sound);
+    nes.connectController(controller);
+    nes.setCatchUpSchedulingEnabled(true);
+    nes.setInstructionSteppingEnabled(true);
+    nes.setScanlineRendererEnabled(true);
+}
+
+NESPool::NESPool(const uint32_t& instance_count, const uint32_t& thread_count, const uint32_t& sound_buffer_size):
+    worker_count_(0), step_generation_(0), frames_to_step_(0), busy_worker_count_(0), is_stopping_(false) {
+    instances_.reserve(instance_count);
+    for (uint32_t i = 0; i < instance_count; i++) {
+        instances_.push_back(std::make_unique<Instance>(sound_buffer_size));
+    }
+
+    // More workers than instances would never have work
+    worker_count_ = (thread_count > 0) ? thread_count : std::max(std::thread::hardware_concurrency(), 1u);
+    worker_count_ = std::max(std::min(worker_count_, instance_count), 1u);
+
+    work_ranges_ = std::make_unique<WorkRange[]>(worker_count_);
+    for (uint32_t i = 0; i < worker_count_; i++) {
+        work_ranges_[i].next_index = 0;
+        work_ranges_[i].end_index = 0;
+    }
+
+    workers_.reserve(worker_count_);
+    for (uint32_t i = 0; i < worker_count_; i++) {
+        workers_.emplace_back(&NESPool::runWorker, this, i);
+    }
+}
+
+NESPool::~NESPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    work_available_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+bool NESPool::loadCartridge(const std::string& path) {
+    std::ifstream nes_rom(path, std::ios::binary);
+    if (!nes_rom.is_open()) {
+        return false;
+    }
+    const std::string rom_data((std::istreambuf_iterator<char>(nes_rom)), std::istreambuf_iterator<char>());
+
+    for (std::unique_ptr<Instance>& instance : instances_) {
+        std::istringstream rom_data_stream(rom_data);
+        instance->nes.loadCartridge(rom_data_stream);
+    }
+    return true;
+}
+
+void NESPool::stepFrames(const uint32_t& frames) {
+    // Every worker starts on an equal share of the instances
+    const uint64_t instance_count = instances_.size();
+    for (uint32_t i = 0; i < worker_count_; i++) {
+        work_ranges_[i].next_index.store(instance_count * i / worker_count_, std::memory_order_relaxed);
+        work_ranges_[i].end_index = instance_count * (i + 1) / worker_count_;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    frames_to_step_ = frames;
+    busy_worker_count_ = worker_count_;
+    step_generation_++;
+    work_available_.notify_all();
+    work_done_.wait(lock, [this] { return busy_worker_count_ == 0; });
+}
+
+uint32_t NESPool::getInstanceCount() const {
+    return instances_.size();
+}
+
+uint32_t NESPool::getThreadCount() const {
+    return worker_count_;
+}
+
+NES& NESPool::getNES(const uint32_t& index) {
+    return instances_.at(index)->nes;
+}
+
+Controller& NESPool::getController(const uint32_t& index) {
+    return instances_.at(index)->controller;
+}
+
+const uint16_t* NESPool::getFrameBuffer(const uint32_t& index) const {
+    return instances_.at(index)->window.getFrameBuffer();
+}
+
+const NESSoundBuffer& NESPool::getSoundBuffer(const uint32_t& index) const {
+    return instances_.at(index)->sound;
+}
+
+void NESPool::runWorker(const uint32_t& worker_index) {
+    // An unpinned worker still runs, on any core the process is allowed to use
+    pinThreadToCore();
+
+    uint64_t seen_generation = 0;
+    while (true) {
+        uint32_t frames = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_available_.wait(lock, [&] { return is_stopping_ || (step_generation_ != seen_generation); });
+            if (is_stopping_) {
+                return;
+            }
+            seen_generation = step_generation_;
+            frames = frames_to_step_;
+        }
+
+        // The worker's own range first, then the other ranges starting from the next worker
+        for (uint32_t offset = 0; offset < worker_count_; offset++) {
+            WorkRange& range = work_ranges_[(worker_index + offset) % worker_count_];
+            uint32_t index = 0;
+            while (claimInstance(range, index)) {
+                Instance& instance = *instances_[index];
+                instance.sound.clear();
+                for (uint32_t frame = 0; frame < frames; frame++) {
+                    instance.nes.stepFrame();
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--busy_worker_count_ == 0) {
+            work_done_.notify_one();
+        }
+    }
+}
+
+bool NESPool::claimInstance(WorkRange& range, uint32_t& index) {
+    // Cheap check first, so finished ranges aren't written to by every thief
+    if (range.next_index.load(std::memory_order_relaxed) >= range.end_index) {
+        return false;
+    }
+    index = range.next_index.fetch_add(1, std::memory_order_relaxed);
+    return index < range.end_index;
+}
+
+bool NESPool::pinThreadToCore() {
+#ifdef __linux__
+    // Cores are handed out process-wide, so the workers of several pools don't share cores while others are free
+    static std::atomic<uint32_t> s_next_core_index{0};
+
+    // Only the cores the process is allowed to run on are used, which taskset, cgroups and containers may restrict
+    cpu_set_t allowed_cpu_set;
+    CPU_ZERO(&allowed_cpu_set);
+    if (sched_getaffinity(0, sizeof(allowed_cpu_set), &allowed_cpu_set) != 0) {
+        return false;
+    }
+    const int allowed_core_count = CPU_COUNT(&allowed_cpu_set);
+    if (allowed_core_count <= 0) {
+        return false;
+    }
+
+    const int allowed_index = static_cast<int>(
+        s_next_core_index.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(allowed_core_count));
+    int core = -1;
+    for (int i = 0; i <= allowed_index; i++) {
+        do {
+            core++;
+        } while (!CPU_ISSET(core, &allowed_cpu_set));
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core, &cpu_set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
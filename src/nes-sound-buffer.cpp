@@ -0,0 +1,24 @@
+#include "nes-sound-buffer.hpp"
+
+NESSoundBuffer::NESSoundBuffer(const uint32_t& capacity): 
+    capacity_(capacity), samples_(std::make_unique<float[]>(capacity)), sample_count_(0) {}
+
+void NESSoundBuffer::queueSample(const float& sample) {
+    if (sample_count_ < capacity_) {
+        samples_[sample_count_++] = sample;
+    }
+}
+
+void NESSoundBuffer::play() {}
+
+const float* NESSoundBuffer::getSamples() const {
+    return samples_.get();
+}
+
+uint32_t NESSoundBuffer::getSampleCount() const {
+    return sample_count_;
+}
+
+void NESSoundBuffer::clear() {
+    sample_count_ = 0;
+}
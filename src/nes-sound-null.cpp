@@ -0,0 +1,5 @@
+#include "nes-sound-null.hpp"
+
+void NESSoundNull::queueSample(const float&) {}
+
+void NESSoundNull::play() {}
@@ -1,22 +1,50 @@
 #include "nes-sound-sfml.hpp"
+// Standard Library Headers
+#include <algorithm>
+// Project Headers
+#include "trace-recorder.hpp"
 
-NESSoundSFML::NESSoundSFML(const uint32_t& sample_buffer_size): 
-    sample_buffer_size_(sample_buffer_size), sample_count_(0), 
-    sample_buffer_(std::make_unique<int16_t[]>(sample_buffer_size)),
-    sound_stream_() {}
+NESSoundSFML::NESSoundSFML(const uint32_t& sample_buffer_size, const uint32_t& latency):
+    sample_count_(0), sample_buffer_size_(std::max<uint32_t>(sample_buffer_size, RATE_CONTROL_RESAMPLER_MAX_OUTPUT_SAMPLES)),
+    sample_buffer_(std::make_unique<int16_t[]>(sample_buffer_size_)),
+    target_queued_sample_count_(std::clamp<uint32_t>(latency, NES_SOUND_SFML_MIN_LATENCY, NES_SOUND_SFML_MAX_LATENCY) * NES_SOUND_SAMPLE_RATE / 1000),
+    resampler_(), sound_stream_() {}
 
 void NESSoundSFML::queueSample(const float& sample) {
-    if (sample_count_ >= sample_buffer_size_) return;
-    // float sample (from 0.0f to 1.0f) to 16 bit PCM sample
-    int16_t converted_sample = sample * 32767;
-    sample_buffer_[sample_count_] = converted_sample;
-    sample_count_++;
+    // Make room for the resampled samples instead of dropping them
+    if (sample_count_ + RATE_CONTROL_RESAMPLER_MAX_OUTPUT_SAMPLES > sample_buffer_size_) {
+        flushSamples();
+    }
+    float resampled[RATE_CONTROL_RESAMPLER_MAX_OUTPUT_SAMPLES];
+    uint32_t resampled_count = resampler_.resample(sample, resampled);
+    for (uint32_t i = 0; i < resampled_count; i++) {
+        // float sample (from 0.0f to 1.0f) to 16 bit PCM sample
+        sample_buffer_[sample_count_] = std::clamp(resampled[i], -1.0f, 1.0f) * 32767;
+        sample_count_++;
+    }
 }
 
 void NESSoundSFML::play() {
-    sound_stream_.queueSampleChunk(sample_buffer_.get(), sample_count_);
-    sample_count_ = 0;
-    if (sound_stream_.getStatus() != sf::SoundSource::Status::Playing) {
+    NES_TRACE_SCOPE("NESSoundSFML::play");
+    flushSamples();
+    uint32_t queued_sample_count = sound_stream_.getQueuedSampleCount();
+    // Steer the rate for the next frame from how far the queue is from the target latency
+    resampler_.updateRatio(queued_sample_count, target_queued_sample_count_);
+    // Wait for the target latency to be queued before starting, so the stream doesn't run dry right away
+    if ((sound_stream_.getStatus() != sf::SoundSource::Status::Playing) && (queued_sample_count >= target_queued_sample_count_)) {
         sound_stream_.play();
     }
 }
+
+uint32_t NESSoundSFML::getQueuedSampleCount() const {
+    return sound_stream_.getQueuedSampleCount();
+}
+
+uint32_t NESSoundSFML::getQueueCapacity() const {
+    return sound_stream_.getQueueCapacity();
+}
+
+void NESSoundSFML::flushSamples() {
+    sound_stream_.queueSampleChunk(sample_buffer_.get(), sample_count_);
+    sample_count_ = 0;
+}
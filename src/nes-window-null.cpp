@@ -0,0 +1,3 @@
+#include "nes-window-null.hpp"
+
+void NESWindowNull::render() {}
@@ -1,5 +1,7 @@
 #include "nes-window-sfml.hpp"
 #include "nes-window.hpp"
+// Project Headers
+#include "trace-recorder.hpp"
 
 NESWindowSFML::NESWindowSFML(const uint16_t& frame_rate_limit, const uint16_t& window_width, const uint16_t& window_height, const std::string& window_title): 
     window_(sf::VideoMode(sf::Vector2u{window_width, window_height}), window_title),
@@ -14,16 +16,13 @@ NESWindowSFML::~NESWindowSFML() {
     window_.close();
 }
 
-void NESWindowSFML::setPixel(const uint16_t& x, const uint16_t& y, const Colour& colour) {
-    if (x < NES_WINDOW_WIDTH && y < NES_WINDOW_HEIGHT) {
-        pixel_buffer_[(y * NES_WINDOW_WIDTH + x) * 4 + 0] = colour.r;
-        pixel_buffer_[(y * NES_WINDOW_WIDTH + x) * 4 + 1] = colour.g;
-        pixel_buffer_[(y * NES_WINDOW_WIDTH + x) * 4 + 2] = colour.b;
-        pixel_buffer_[(y * NES_WINDOW_WIDTH + x) * 4 + 3] = 255; // Solid Alpha
-    }
+void NESWindowSFML::onFrameComplete() {
+    // Convert the whole frame to RGBA for the display texture
+    convertFrameToRGBA(pixel_buffer_.get());
 }
 
 void NESWindowSFML::render() {
+    NES_TRACE_SCOPE("NESWindowSFML::render");
     window_.clear(sf::Color::Black);
     display_texture_.update(pixel_buffer_.get());
     window_.draw(display_sprite_);
@@ -0,0 +1,169 @@
+#include "nes-window.hpp"
+// Standard Library Headers
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// Thanks to OLC
+const std::array<NESWindow::Colour, NES_WINDOW_PALETTE_SIZE> NESWindow::system_palette = {{
+    { 84,  84,  84}, {  0,  30, 116}, {  8,  16, 144}, { 48,   0, 136},
+    { 68,   0, 100}, { 92,   0,  48}, { 84,   4,   0}, { 60,  24,   0},
+    { 32,  42,   0}, {  8,  58,   0}, {  0,  64,   0}, {  0,  60,   0},
+    {  0,  50,  60}, {  0,   0,   0}, {  0,   0,   0}, {  0,   0,   0},
+
+    {152, 150, 152}, {  8,  76, 196}, { 48,  50, 236}, { 92,  30, 228},
+    {136,  20, 176}, {160,  20, 100}, {152,  34,  32}, {120,  60,   0},
+    { 84,  90,   0}, { 40, 114,   0}, {  8, 124,   0}, {  0, 118,  40},
+    {  0, 102, 120}, {  0,   0,   0}, {  0,   0,   0}, {  0,   0,   0},
+
+    {236, 238, 236}, { 76, 154, 236}, {120, 124, 236}, {176,  98, 236},
+    {228,  84, 236}, {236,  88, 180}, {236, 106, 100}, {212, 136,  32},
+    {160, 170,   0}, {116, 196,   0}, { 76, 208,  32}, { 56, 204, 108},
+    { 56, 180, 204}, { 60,  60,  60}, {  0,   0,   0}, {  0,   0,   0},
+
+    {236, 238, 236}, {168, 204, 236}, {188, 188, 236}, {212, 178, 236},
+    {236, 174, 236}, {236, 174, 212}, {236, 180, 176}, {228, 196, 144},
+    {204, 210, 120}, {180, 222, 120}, {168, 226, 144}, {152, 226, 180},
+    {160, 214, 228}, {160, 162, 160}, {  0,   0,   0}, {  0,   0,   0},
+}};
+
+#if defined(__x86_64__) || defined(__i386__)
+// System palette packed as RGBA bytes in memory order, the SIMD paths are x86 only so the host is little-endian
+static const std::array<uint32_t, NES_WINDOW_PALETTE_SIZE> rgba_palette = [] {
+    std::array<uint32_t, NES_WINDOW_PALETTE_SIZE> lut{};
+    for (uint32_t i = 0; i < NES_WINDOW_PALETTE_SIZE; i++) {
+        const NESWindow::Colour& colour = NESWindow::system_palette[i];
+        lut[i] = colour.r | (colour.g << 8) | (colour.b << 16) | (0xFFu << 24); // Solid Alpha
+    }
+    return lut;
+}();
+
+// System palette split by channel into blocks of 16 entries, the size of a byte shuffle table
+//   [channel][block][index within the block]
+static const std::array<std::array<std::array<uint8_t, 16>, NES_WINDOW_PALETTE_SIZE / 16>, 3> channel_palette = [] {
+    std::array<std::array<std::array<uint8_t, 16>, NES_WINDOW_PALETTE_SIZE / 16>, 3> lut{};
+    for (uint32_t i = 0; i < NES_WINDOW_PALETTE_SIZE; i++) {
+        const NESWindow::Colour& colour = NESWindow::system_palette[i];
+        lut[0][i / 16][i % 16] = colour.r;
+        lut[1][i / 16][i % 16] = colour.g;
+        lut[2][i / 16][i % 16] = colour.b;
+    }
+    return lut;
+}();
+#endif
+
+NESWindow::NESWindow(): frame_buffer_(std::make_unique<uint16_t[]>(NES_WINDOW_WIDTH * NES_WINDOW_HEIGHT)) {}
+
+uint16_t* NESWindow::getFrameBuffer() const {
+    return frame_buffer_.get();
+}
+
+void NESWindow::onScanline(const uint16_t&) {}
+
+void NESWindow::onFrameComplete() {}
+
+void NESWindow::convertScanlineToRGBA(const uint16_t& y, uint8_t* rgba_buffer) const {
+    convertToRGBA(frame_buffer_.get() + y * NES_WINDOW_WIDTH, NES_WINDOW_WIDTH, rgba_buffer);
+}
+
+void NESWindow::convertFrameToRGBA(uint8_t* rgba_buffer) const {
+    convertToRGBA(frame_buffer_.get(), NES_WINDOW_WIDTH * NES_WINDOW_HEIGHT, rgba_buffer);
+}
+
+void NESWindow::convertToRGBA(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer) {
+    // The fastest conversion the host supports is chosen on the first call
+    static const ConvertFunction convert = [] {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return &NESWindow::convertToRGBAAVX2;
+        }
+        if (__builtin_cpu_supports("ssse3")) {
+            return &NESWindow::convertToRGBASSSE3;
+        }
+#endif
+        return &NESWindow::convertToRGBAScalar;
+    }();
+    convert(pixels, pixel_count, rgba_buffer);
+}
+
+void NESWindow::convertToRGBAScalar(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer) {
+    for (uint32_t i = 0; i < pixel_count; i++) {
+        const Colour& colour = system_palette[pixels[i] & NES_WINDOW_PIXEL_PALETTE_INDEX_MASK];
+        rgba_buffer[i * 4 + 0] = colour.r;
+        rgba_buffer[i * 4 + 1] = colour.g;
+        rgba_buffer[i * 4 + 2] = colour.b;
+        rgba_buffer[i * 4 + 3] = 255; // Solid Alpha
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+void NESWindow::convertToRGBAAVX2(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer) {
+    uint32_t i = 0;
+
+    // 8 pixels at a time, gathering their colours from the palette
+    const __m256i palette_index_mask = _mm256_set1_epi32(NES_WINDOW_PIXEL_PALETTE_INDEX_MASK);
+    for (; i + 8 <= pixel_count; i += 8) {
+        __m256i palette_indices = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i)));
+        palette_indices = _mm256_and_si256(palette_indices, palette_index_mask);
+        const __m256i colours = _mm256_i32gather_epi32(reinterpret_cast<const int*>(rgba_palette.data()), palette_indices, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rgba_buffer + i * 4), colours);
+    }
+
+    convertToRGBAScalar(pixels + i, pixel_count - i, rgba_buffer + i * 4);
+}
+
+__attribute__((target("ssse3")))
+void NESWindow::convertToRGBASSSE3(const uint16_t* pixels, const uint32_t& pixel_count, uint8_t* rgba_buffer) {
+    uint32_t i = 0;
+
+    // Each channel of the palette is 4 shuffle tables of 16 entries, vector types can't be std::array elements
+    constexpr uint32_t channel_count = 3;
+    constexpr uint32_t block_count = NES_WINDOW_PALETTE_SIZE / 16;
+    __m128i tables[channel_count][block_count];
+    for (uint32_t channel = 0; channel < channel_count; channel++) {
+        for (uint32_t block = 0; block < block_count; block++) {
+            tables[channel][block] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channel_palette[channel][block].data()));
+        }
+    }
+
+    // 16 pixels at a time, each channel is looked up in every table and the lookups are combined
+    //   The indices into a table are moved to 0x70-0x7F for the pixels in it, and saturated to 0x80 or above for the
+    //   others, so the shuffle only keeps the low 4 bits of the pixels in the table and zeroes the rest
+    const __m128i palette_index_mask = _mm_set1_epi16(NES_WINDOW_PIXEL_PALETTE_INDEX_MASK);
+    const __m128i table_index_offset = _mm_set1_epi8(0x70);
+    const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF)); // Solid Alpha
+    for (; i + 16 <= pixel_count; i += 16) {
+        const __m128i pixels_lo = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i)), palette_index_mask);
+        const __m128i pixels_hi = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i + 8)), palette_index_mask);
+        const __m128i palette_indices = _mm_packus_epi16(pixels_lo, pixels_hi);
+
+        __m128i table_indices[block_count];
+        for (uint32_t block = 0; block < block_count; block++) {
+            const __m128i block_indices = _mm_sub_epi8(palette_indices, _mm_set1_epi8(static_cast<char>(block * 16)));
+            table_indices[block] = _mm_adds_epu8(block_indices, table_index_offset);
+        }
+        __m128i channels[channel_count];
+        for (uint32_t channel = 0; channel < channel_count; channel++) {
+            channels[channel] = _mm_shuffle_epi8(tables[channel][0], table_indices[0]);
+            for (uint32_t block = 1; block < block_count; block++) {
+                channels[channel] = _mm_or_si128(channels[channel], _mm_shuffle_epi8(tables[channel][block], table_indices[block]));
+            }
+        }
+
+        // Interleave the channels into RGBA
+        const __m128i rg_lo = _mm_unpacklo_epi8(channels[0], channels[1]);
+        const __m128i rg_hi = _mm_unpackhi_epi8(channels[0], channels[1]);
+        const __m128i ba_lo = _mm_unpacklo_epi8(channels[2], alpha);
+        const __m128i ba_hi = _mm_unpackhi_epi8(channels[2], alpha);
+        __m128i* output = reinterpret_cast<__m128i*>(rgba_buffer + i * 4);
+        _mm_storeu_si128(output + 0, _mm_unpacklo_epi16(rg_lo, ba_lo));
+        _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(rg_lo, ba_lo));
+        _mm_storeu_si128(output + 2, _mm_unpacklo_epi16(rg_hi, ba_hi));
+        _mm_storeu_si128(output + 3, _mm_unpackhi_epi16(rg_hi, ba_hi));
+    }
+
+    convertToRGBAScalar(pixels + i, pixel_count - i, rgba_buffer + i * 4);
+}
+#endif
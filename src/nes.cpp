@@ -1,37 +1,60 @@
 #include "nes.hpp"
 // Standard Library Headers
-#include <fstream>
+#include <algorithm>
 #include <iostream>
 // Project Headers
 #include "cartridge.hpp"
+#include "trace-recorder.hpp"
 
 NES::NES(): 
-    clock_count_(0), cpu_(), ram_(CPU_BUS_RAM_SIZE), 
+    clock_count_(0), is_catch_up_scheduling_enabled_(false), 
+    is_instruction_stepping_enabled_(false), run_ahead_frames_(0), 
+    window_(nullptr), sound_system_(nullptr), cpu_(), ram_(CPU_BUS_RAM_SIZE), 
     ppu_(), vram_(PPU_BUS_NAME_TABLE_SIZE), palette_table_(PPU_BUS_PALETTE_TABLE_SIZE), 
-    cartridge_(nullptr), cpu_bus_(cpu_, ram_, ppu_, cartridge_), ppu_bus_(ppu_, vram_, cartridge_) {}
+    cartridge_(nullptr), cpu_bus_(cpu_, ram_, ppu_, cartridge_), ppu_bus_(ppu_, vram_, cartridge_), scheduler_(), perf_counters_(), 
+    save_state_size_(0) {
+    cpu_.connectPerfCounters(&perf_counters_);
+    ppu_.connectPerfCounters(&perf_counters_);
+    cpu_bus_.connectPerfCounters(&perf_counters_);
+    save_state_size_ = computeSaveStateSize();
+}
 
 void NES::connectDisplayWindow(NESWindow& window) {
-    ppu_.connectDisplayWindow(&window);
+    window_ = &window;
+    ppu_.connectDisplayWindow(window_);
 }
 
 void NES::connectSoundSystem(NESSound& sound_system) {
+    sound_system_ = &sound_system;
     cpu_.connectSoundSystem(sound_system);
 }
 
 void NES::loadCartridge(const std::string& path) {
-    // Open the file
-    std::ifstream nes_rom;
-    nes_rom.open(path, std::ios::binary);
-    if (!nes_rom.is_open()) {
+    // The file is mapped instead of read, so loading takes the same time for any ROM size
+    cartridge_ = Cartridge::makeCartridge(path);
+    if (!cartridge_) {
         std::cerr << "Failed to open the file" << std::endl;
     }
 
-    cartridge_ = Cartridge::makeCartridge(nes_rom);
+    cpu_bus_.mapCartridgePages();
+    ppu_bus_.mapMemoryPages();
+    save_state_size_ = computeSaveStateSize();
+    cpu_.reset();
+}
+
+void NES::loadCartridge(std::istream& rom_data_stream) {
+    cartridge_ = Cartridge::makeCartridge(rom_data_stream);
+    cpu_bus_.mapCartridgePages();
+    ppu_bus_.mapMemoryPages();
+    save_state_size_ = computeSaveStateSize();
     cpu_.reset();
 }
 
 void NES::releaseCartridge() {
     cartridge_.reset();
+    cpu_bus_.mapCartridgePages();
+    ppu_bus_.mapMemoryPages();
+    save_state_size_ = computeSaveStateSize();
 }
 
 void NES::clock() {
@@ -52,13 +75,216 @@ void NES::clock() {
     clock_count_++;
 }
 
-void NES::stepFrame() {
-    // In reality it's 89341.5 clocks per frame
-    for (uint64_t i = 0; i < 89342; i++) {
-        clock();
+uint32_t NES::stepFrame() {
+    NES_TRACE_SCOPE("NES::stepFrame");
+    if ((run_ahead_frames_ == 0) || !cartridge_) {
+        return runFrame();
+    }
+
+    // The frame with the current input is the one kept, only its audio is output
+    ppu_.connectDisplayWindow(nullptr);
+    const uint32_t frame_clock_count = runFrame();
+
+    const uint32_t state_size = save_state_size_;
+    if (run_ahead_state_.size() != state_size) {
+        run_ahead_state_.resize(state_size);
+    }
+    saveState(run_ahead_state_.data(), state_size);
+
+    // The frames ahead show what the input will look like, only the last one is displayed
+    cpu_.disconnectSoundSystem();
+    for (uint8_t i = 1; i < run_ahead_frames_; i++) {
+        runFrame();
+    }
+    ppu_.connectDisplayWindow(window_);
+    runFrame();
+    if (sound_system_ != nullptr) {
+        cpu_.connectSoundSystem(*sound_system_);
+    }
+
+    loadState(run_ahead_state_.data(), state_size);
+    return frame_clock_count;
+}
+
+void NES::setRunAheadFrames(const uint8_t& frames) {
+    run_ahead_frames_ = frames;
+}
+
+uint32_t NES::runFrame() {
+    NES_PERF_FRAME(&perf_counters_);
+    const uint64_t frame_start_clock_count = clock_count_;
+    ppu_.setFrameCompleteFlag(false);
+
+    if (!is_catch_up_scheduling_enabled_ && !is_instruction_stepping_enabled_) {
+        while (!ppu_.getFrameCompleteFlag()) {
+            clock();
+        }
+        cpu_.endAudioFrame();
+        return clock_count_ - frame_start_clock_count;
+    }
+
+    // The PPU runs 1 cycle every clock, so the clock it completes the frame on is known ahead
+    const uint64_t frame_end_clock_count = clock_count_ + ppu_.getCyclesUntilFrameComplete();
+    // The events are scheduled again every frame, as the state may have been loaded or reset since the last one
+    scheduleEvents();
+    while (clock_count_ < frame_end_clock_count) {
+        if (clock_count_ % 3 == 0) {
+            // The CPU runs freely until the next event, the PPU and the APU are caught up if the CPU touches them
+            const uint64_t slice_end_clock_count = std::min(scheduler_.getNextEventTime(), frame_end_clock_count);
+            do {
+                // The PPU cycle of this clock runs before the CPU cycle
+                ppu_.deferCycles(1);
+
+                // Instructions that could run past the end of the frame are stepped by cycles instead
+                if (!is_instruction_stepping_enabled_ || 
+                    frame_end_clock_count - clock_count_ < 3 * MOS6502_MAX_INSTRUCTION_CYCLES) {
+                    cpu_.runCycle();
+                    clock_count_++;
+                    break;
+                }
+
+                const uint8_t cpu_cycles = cpu_.runInstruction();
+
+                // NMI requested on the clock of the instruction is handled after the instruction
+                if (ppu_.getNMIFlag()) {
+                    cpu_.nmi();
+                    ppu_.setNMIFlag(false);
+                }
+
+                // The rest of the instruction's clocks only run the PPU
+                ppu_.deferCycles(3 * cpu_cycles - 1);
+                clock_count_ += 3 * cpu_cycles;
+            } while (clock_count_ < slice_end_clock_count);
+        }
+        else {
+            // Clocks until the next CPU cycle only run the PPU
+            const uint64_t ppu_only_clocks = std::min(3 - clock_count_ % 3, frame_end_clock_count - clock_count_);
+            ppu_.deferCycles(ppu_only_clocks);
+            clock_count_ += ppu_only_clocks;
+        }
+
+        Scheduler::Event event;
+        while (scheduler_.popDueEvent(clock_count_, event)) {
+            handleEvent(event);
+        }
+
+        // PPU Request to trigger NMI, raised when the PPU catches up to the start of VBlank
+        if (ppu_.getNMIFlag()) {
+            cpu_.nmi();
+            ppu_.setNMIFlag(false);
+        }
+    }
+
+    // Finish the frame so it can be displayed, and its audio played
+    ppu_.catchUp();
+    cpu_.endAudioFrame();
+    return clock_count_ - frame_start_clock_count;
+}
+
+void NES::scheduleEvents() {
+    scheduler_.schedule(Scheduler::Event::PPU_VBLANK, clock_count_ + ppu_.getCyclesUntilVBlank());
+    // The APU is clocked every CPU cycle, which is every 3 clocks
+    scheduler_.schedule(Scheduler::Event::APU_FRAME_SEQUENCER, clock_count_ + (3 * cpu_.getCyclesUntilAPUSequencerStep()));
+}
+
+void NES::handleEvent(const Scheduler::Event& event) {
+    switch (event) {
+        case Scheduler::Event::PPU_VBLANK:
+            ppu_.catchUp();
+            scheduler_.schedule(Scheduler::Event::PPU_VBLANK, clock_count_ + ppu_.getCyclesUntilVBlank());
+            break;
+        case Scheduler::Event::APU_FRAME_SEQUENCER:
+            cpu_.catchUpAPU();
+            scheduler_.schedule(Scheduler::Event::APU_FRAME_SEQUENCER, clock_count_ + (3 * cpu_.getCyclesUntilAPUSequencerStep()));
+            break;
+        default:
+            break;
     }
 }
 
+PerfCounters::Snapshot NES::getPerfCounters() const {
+    return perf_counters_.getSnapshot();
+}
+
+void NES::setPerfCountersDumpStream(std::ostream* stream) {
+    perf_counters_.setDumpStream(stream);
+}
+
+void NES::setCatchUpSchedulingEnabled(const bool& value) {
+    ppu_.catchUp();
+    is_catch_up_scheduling_enabled_ = value;
+}
+
+void NES::setInstructionSteppingEnabled(const bool& value) {
+    ppu_.catchUp();
+    is_instruction_stepping_enabled_ = value;
+}
+
+void NES::setScanlineRendererEnabled(const bool& value) {
+    ppu_.setScanlineRendererEnabled(value);
+}
+
 void NES::connectController(Controller& controller) {
     cpu_bus_.connectController(&controller);
 }
+
+uint32_t NES::getSaveStateSize() const {
+    return save_state_size_;
+}
+
+bool NES::saveState(uint8_t* buffer, const uint32_t& buffer_size) const {
+    if (buffer_size < save_state_size_) {
+        return false;
+    }
+
+    SaveStateWriter writer(buffer, buffer_size);
+    writer.write(SaveStateHeader{SAVE_STATE_MAGIC, SAVE_STATE_VERSION, save_state_size_});
+    saveComponentStates(writer);
+    return writer.isValid();
+}
+
+bool NES::loadState(const uint8_t* buffer, const uint32_t& buffer_size) {
+    SaveStateReader reader(buffer, buffer_size);
+    SaveStateHeader header{};
+    reader.read(header);
+    // The size check also rejects most states of other cartridges
+    if (!reader.isValid() || (header.magic != SAVE_STATE_MAGIC) || (header.version != SAVE_STATE_VERSION) || 
+        (header.size != save_state_size_) || (buffer_size < save_state_size_)) {
+        return false;
+    }
+
+    reader.read(clock_count_);
+    cpu_.loadState(reader);
+    ram_.loadState(reader);
+    ppu_.loadState(reader);
+    vram_.loadState(reader);
+    if (cartridge_) {
+        cartridge_->loadState(reader);
+    }
+    cpu_bus_.loadState(reader);
+
+    // Mapper registers may have switched banks
+    cpu_bus_.mapCartridgePages();
+    ppu_bus_.mapMemoryPages();
+    return reader.isValid();
+}
+
+uint32_t NES::computeSaveStateSize() const {
+    // Writing without a buffer only counts the size
+    SaveStateWriter writer(nullptr, 0);
+    writer.write(SaveStateHeader{});
+    saveComponentStates(writer);
+    return writer.getSize();
+}
+
+void NES::saveComponentStates(SaveStateWriter& writer) const {
+    writer.write(clock_count_);
+    cpu_.saveState(writer);
+    ram_.saveState(writer);
+    ppu_.saveState(writer);
+    vram_.saveState(writer);
+    if (cartridge_) {
+        cartridge_->saveState(writer);
+    }
+    cpu_bus_.saveState(writer);
+}
@@ -0,0 +1,76 @@
+#include "perf-counters.hpp"
+// File specific constants
+static constexpr std::array<const char*, static_cast<uint8_t>(PerfCounters::Subsystem::COUNT)> S_SUBSYSTEM_NAMES = {
+    "system", "cpu", "ppu", "apu",
+};
+static constexpr std::array<const char*, static_cast<uint8_t>(PerfCounters::BusRegion::COUNT)> S_BUS_REGION_NAMES = {
+    "ram", "ppu_registers", "apu_io", "cartridge",
+};
+
+PerfCounters::PerfCounters():
+    frame_count_(0), frame_(), last_frame_(), total_(),
+    current_subsystem_(Subsystem::SYSTEM), last_timestamp_(0), dump_stream_(nullptr) {}
+
+void PerfCounters::beginFrame() {
+    // Only what runs during a frame is recorded
+    frame_ = Counters();
+    current_subsystem_ = Subsystem::SYSTEM;
+    last_timestamp_ = readTimestamp();
+}
+
+void PerfCounters::endFrame() {
+    switchSubsystem(Subsystem::SYSTEM);
+
+    last_frame_ = frame_;
+    for (uint8_t i = 0; i < total_.subsystem_ticks.size(); i++) {
+        total_.subsystem_ticks[i] += frame_.subsystem_ticks[i];
+    }
+    for (uint8_t i = 0; i < total_.bus_reads.size(); i++) {
+        total_.bus_reads[i] += frame_.bus_reads[i];
+        total_.bus_writes[i] += frame_.bus_writes[i];
+    }
+    frame_ = Counters();
+    frame_count_++;
+
+    if (dump_stream_) {
+        writeDumpRow(*dump_stream_);
+    }
+}
+
+void PerfCounters::reset() {
+    frame_count_ = 0;
+    frame_ = Counters();
+    last_frame_ = Counters();
+    total_ = Counters();
+}
+
+PerfCounters::Snapshot PerfCounters::getSnapshot() const {
+    return {frame_count_, last_frame_, total_};
+}
+
+void PerfCounters::setDumpStream(std::ostream* stream) {
+    dump_stream_ = stream;
+    if (!dump_stream_) {
+        return;
+    }
+
+    *dump_stream_ << "frame";
+    for (const char* name : S_SUBSYSTEM_NAMES) {
+        *dump_stream_ << "," << name << "_ticks";
+    }
+    for (const char* name : S_BUS_REGION_NAMES) {
+        *dump_stream_ << "," << name << "_reads," << name << "_writes";
+    }
+    *dump_stream_ << "\n";
+}
+
+void PerfCounters::writeDumpRow(std::ostream& stream) const {
+    stream << frame_count_;
+    for (const uint64_t& ticks : last_frame_.subsystem_ticks) {
+        stream << "," << ticks;
+    }
+    for (uint8_t i = 0; i < last_frame_.bus_reads.size(); i++) {
+        stream << "," << last_frame_.bus_reads[i] << "," << last_frame_.bus_writes[i];
+    }
+    stream << "\n";
+}
@@ -1,63 +1,17 @@
 #include "ppu-bus.hpp"
 
 PPUBUS::PPUBUS(RP2C02& ppu, MemoryUnit& vram, const std::unique_ptr<Cartridge>& cartridge): 
-    ppu_{ppu}, vram_{vram}, cartridge_{cartridge} {
+    ppu_{ppu}, vram_{vram}, cartridge_{cartridge}, memory_pages_(), name_table_pages_(), empty_pattern_table_page_(RP2C02_MEMORY_PAGE_SIZE) {
+    mapMemoryPages();
     ppu_.connectBUS(this);
+    ppu_.connectMemoryPages(&memory_pages_);
 }
 
 uint8_t PPUBUS::readBusData(const uint16_t& address) const {
-    // Retrieve pattern table data from the Cartridge
-    if ((0x0000 <= address) && (address <= 0x1FFF)) {
+    // Retrieve pattern table data from the Cartridge and name table data from the Name Table
+    if ((0x0000 <= address) && (address <= 0x3EFF)) {
         ppu_.setReadFromDataBuffer(true);
-        if (!cartridge_) {
-            // We can do something here for when the cartridge is not loaded
-            return 0;
-        }
-        return cartridge_->readChrMem(address);
-    }
-
-    // Retrieve name table data from the Name Table
-    if ((0x2000 <= address) && (address <= 0x3EFF)) {
-        ppu_.setReadFromDataBuffer(true);
-
-        // Maps the bus address to the address of the 4 addressing name tables
-        uint16_t adressing_name_table_address = (address - 0x2000) % (sizeof(RP2C02::NameTable) * 4);
-        
-        // Cartridge is not loaded
-        if (!cartridge_) {
-            return vram_.read(adressing_name_table_address % vram_.getSize());
-        }
-
-        // Determine which of the 4 addressing name tables are being accessed
-        uint8_t addressing_name_table_index = adressing_name_table_address / sizeof(RP2C02::NameTable);
-
-        switch (cartridge_->getMirrorMode()) {
-            case Cartridge::MirrorMode::HORIZONTAL: {
-                if ((addressing_name_table_index == 1) || (addressing_name_table_index == 2)) {
-                    // Maps the second addressing name table to the first vram name table
-                    // Maps the third addressing name table to the second vram name table
-                    return vram_.read(adressing_name_table_address - 0x0400);
-                }
-                if (addressing_name_table_index == 3) {
-                    // Mirroring the fourth name table to the second vram name table
-                    return vram_.read(adressing_name_table_address - 0x0800);
-                }
-                // Default case, return the first name table
-                return vram_.read(adressing_name_table_address);
-            }
-            case Cartridge::MirrorMode::VERTICAL: {
-                if ((addressing_name_table_index == 2) || (addressing_name_table_index == 3)) {
-                    // Maps the third addressing name table to the first vram name table
-                    // Maps the fourth addressing name table to the second vram name table
-                    return vram_.read(adressing_name_table_address - 0x0800);
-                }
-                // Default case, return the first name table and second name table
-                return vram_.read(adressing_name_table_address);
-            }
-            default: {
-                return vram_.read(adressing_name_table_address % vram_.getSize());
-            }
-        }
+        return memory_pages_[address / RP2C02_MEMORY_PAGE_SIZE][address % RP2C02_MEMORY_PAGE_SIZE];
     }
 
     // Retrieve palette data from the Palette Table
@@ -87,44 +41,8 @@ bool PPUBUS::writeBusData(const uint16_t& address, const uint8_t& data) {
 
     // Write data to the Name Table
     if ((0x2000 <= address) && (address <= 0x3EFF)) {
-        // Maps the bus address to the address of the 4 addressing name tables
-        uint16_t adressing_name_table_address = (address - 0x2000) % (sizeof(RP2C02::NameTable) * 4);
-        
-        // Cartridge is not loaded
-        if (!cartridge_) {
-            return vram_.write(adressing_name_table_address % vram_.getSize(), data);
-        }
-
-        // Determine which of the 4 addressing name tables are being accessed
-        uint8_t addressing_name_table_index = adressing_name_table_address / sizeof(RP2C02::NameTable);
-
-        switch (cartridge_->getMirrorMode()) {
-            case Cartridge::MirrorMode::HORIZONTAL: {
-                if ((addressing_name_table_index == 1) || (addressing_name_table_index == 2)) {
-                    // Maps the second addressing name table to the first vram name table
-                    // Maps the third addressing name table to the second vram name table
-                    return vram_.write(adressing_name_table_address - 0x0400, data);
-                }
-                if (addressing_name_table_index == 3) {
-                    // Mirroring the fourth name table to the second vram name table
-                    return vram_.write(adressing_name_table_address - 0x0800, data);
-                }
-                // Default case, return the first name table
-                return vram_.write(adressing_name_table_address, data);
-            }
-            case Cartridge::MirrorMode::VERTICAL: {
-                if ((addressing_name_table_index == 2) || (addressing_name_table_index == 3)) {
-                    // Maps the third addressing name table to the first vram name table
-                    // Maps the fourth addressing name table to the second vram name table
-                    return vram_.write(adressing_name_table_address - 0x0800, data);
-                }
-                // Default case, return the first name table and second name table
-                return vram_.write(adressing_name_table_address, data);
-            }
-            default: {
-                return vram_.write(adressing_name_table_address % vram_.getSize(), data);
-            }
-        }
+        name_table_pages_[(address / RP2C02_MEMORY_PAGE_SIZE) % 4][address % RP2C02_MEMORY_PAGE_SIZE] = data;
+        return true;
     }
 
     // Write data to the Palette Table
@@ -140,3 +58,31 @@ bool PPUBUS::writeBusData(const uint16_t& address, const uint8_t& data) {
     // Write data to the mirror of 0x0000 to 0x3FFF
     return writeBusData((address - 0x4000) % 0x4000, data);
 }
+
+void PPUBUS::mapMemoryPages() {
+    // Pattern tables from 0x0000 to 0x1FFF
+    for (uint8_t page = 0x0; page <= 0x7; page++) {
+        if (!cartridge_) {
+            // We can do something here for when the cartridge is not loaded
+            memory_pages_.at(page) = empty_pattern_table_page_.getPointer();
+            continue;
+        }
+        memory_pages_.at(page) = cartridge_->getChrMemPage(page * RP2C02_MEMORY_PAGE_SIZE);
+    }
+
+    // Name tables from 0x2000 to 0x2FFF, mirrored from 0x3000 to 0x3EFF
+    for (uint8_t addressing_name_table_index = 0; addressing_name_table_index < name_table_pages_.size(); addressing_name_table_index++) {
+        // Default case, the first and third addressing name tables are mapped to the first vram name table
+        //   and the second and fourth addressing name tables are mapped to the second vram name table
+        uint8_t vram_name_table_index = addressing_name_table_index % 2;
+        if (cartridge_ && (cartridge_->getMirrorMode() == Cartridge::MirrorMode::HORIZONTAL)) {
+            // Maps the first and second addressing name tables to the first vram name table
+            //   and the third and fourth addressing name tables to the second vram name table
+            vram_name_table_index = addressing_name_table_index / 2;
+        }
+        name_table_pages_.at(addressing_name_table_index) = vram_.getPointer() + vram_name_table_index * sizeof(RP2C02::NameTable);
+    }
+    for (uint8_t page = 0x8; page <= 0xF; page++) {
+        memory_pages_.at(page) = name_table_pages_.at(page % 4);
+    }
+}
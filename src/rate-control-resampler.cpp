@@ -0,0 +1,44 @@
+#include "rate-control-resampler.hpp"
+// Standard Library Headers
+#include <algorithm>
+
+RateControlResampler::RateControlResampler(const float& max_deviation):
+    max_deviation_(max_deviation), ratio_(1.0), step_(1.0), accumulated_distance_(0.0), position_(0.0), previous_sample_(0.0f) {}
+
+void RateControlResampler::updateRatio(const uint32_t& fill_level, const uint32_t& target_fill_level) {
+    if (target_fill_level == 0) {
+        return;
+    }
+    // Scale the ratio with the distance from the target
+    double distance = (static_cast<double>(target_fill_level) - static_cast<double>(fill_level)) / target_fill_level;
+    distance = std::clamp(distance, -1.0, 1.0);
+    // A constant rate mismatch, such as the NES frame rate against the display, would otherwise hold the queue away from the target
+    //   So the distance is also accumulated slowly to cancel it out
+    accumulated_distance_ = std::clamp(accumulated_distance_ + (distance * RATE_CONTROL_RESAMPLER_ACCUMULATION_RATE), -1.0, 1.0);
+    ratio_ = 1.0 + (max_deviation_ * std::clamp(distance + accumulated_distance_, -1.0, 1.0));
+    step_ = 1.0 / ratio_;
+}
+
+uint32_t RateControlResampler::resample(const float& sample, float* output) {
+    uint32_t output_count = 0;
+    // Output every sample that falls between the previous and the next input sample
+    while (position_ < 1.0) {
+        output[output_count++] = previous_sample_ + ((sample - previous_sample_) * static_cast<float>(position_));
+        position_ += step_;
+    }
+    position_ -= 1.0;
+    previous_sample_ = sample;
+    return output_count;
+}
+
+double RateControlResampler::getRatio() const {
+    return ratio_;
+}
+
+void RateControlResampler::reset() {
+    ratio_ = 1.0;
+    step_ = 1.0;
+    accumulated_distance_ = 0.0;
+    position_ = 0.0;
+    previous_sample_ = 0.0f;
+}
@@ -0,0 +1,223 @@
+#include "rewind-buffer.hpp"
+// Standard Library Headers
+#include <algorithm>
+#include <cstring>
+// Project Defines
+// Encoded states are a sequence of runs, each a 16-bit count of unchanged bytes then a 16-bit count of changed bytes followed by them
+#define REWIND_BUFFER_RUN_HEADER_SIZE 4
+#define REWIND_BUFFER_MAX_RUN_LENGTH 0xFFFF
+// Shorter unchanged runs are kept inside the changed bytes, as a new run header would cost more
+#define REWIND_BUFFER_MIN_UNCHANGED_RUN_LENGTH 4
+
+RewindBuffer::RewindBuffer(const uint32_t& frame_capacity, const uint32_t& keyframe_interval, const uint32_t& byte_capacity):
+    keyframe_interval_(std::max<uint32_t>(keyframe_interval, 1)),
+    memory_(byte_capacity), write_offset_(0), used_bytes_(0),
+    entries_(frame_capacity), oldest_entry_(0), entry_count_(0), states_since_keyframe_(0) {}
+
+bool RewindBuffer::pushState(const NES& nes) {
+    if (entries_.empty()) {
+        return false;
+    }
+
+    // The scratch buffers are only allocated when the size of the state changes
+    const uint32_t state_size = nes.getSaveStateSize();
+    if (state_.size() != state_size) {
+        clear();
+        state_.resize(state_size);
+        keyframe_state_.resize(state_size);
+        encoded_state_.resize(state_size + REWIND_BUFFER_RUN_HEADER_SIZE * (state_size / REWIND_BUFFER_MAX_RUN_LENGTH + 2));
+    }
+    if (!nes.saveState(state_.data(), state_size)) {
+        return false;
+    }
+
+    bool is_keyframe = (entry_count_ == 0) || (states_since_keyframe_ + 1 >= keyframe_interval_);
+    uint32_t encoded_size = encodeState(is_keyframe ? nullptr : keyframe_state_.data());
+    if (encoded_size > memory_.size()) {
+        return false;
+    }
+
+    if (entry_count_ == entries_.size()) {
+        evictOldestKeyframe();
+    }
+    uint32_t offset = allocateEntry(encoded_size);
+
+    // Evicting can remove the keyframe the difference refers to, the state is then stored as a keyframe
+    if (!is_keyframe && (entry_count_ == 0)) {
+        is_keyframe = true;
+        encoded_size = encodeState(nullptr);
+        if (encoded_size > memory_.size()) {
+            return false;
+        }
+        offset = allocateEntry(encoded_size);
+    }
+
+    std::memcpy(memory_.data() + offset, encoded_state_.data(), encoded_size);
+    entries_[(oldest_entry_ + entry_count_) % entries_.size()] = Entry{offset, encoded_size, is_keyframe};
+    entry_count_++;
+    used_bytes_ += encoded_size;
+    write_offset_ = offset + encoded_size;
+
+    if (is_keyframe) {
+        std::copy(state_.begin(), state_.end(), keyframe_state_.begin());
+        states_since_keyframe_ = 0;
+    }
+    else {
+        states_since_keyframe_++;
+    }
+    return true;
+}
+
+bool RewindBuffer::popState(NES& nes) {
+    if (entry_count_ == 0) {
+        return false;
+    }
+
+    const Entry newest_entry = getEntry(entry_count_ - 1);
+    if (newest_entry.is_keyframe) {
+        std::fill(state_.begin(), state_.end(), 0);
+    }
+    else {
+        std::copy(keyframe_state_.begin(), keyframe_state_.end(), state_.begin());
+    }
+    decodeState(newest_entry, state_.data());
+
+    entry_count_--;
+    used_bytes_ -= newest_entry.size;
+    write_offset_ = newest_entry.offset;
+
+    if (!newest_entry.is_keyframe) {
+        states_since_keyframe_--;
+    }
+    else if (entry_count_ > 0) {
+        // The states left refer to the previous keyframe, the oldest state is always a keyframe
+        uint32_t keyframe_index = entry_count_ - 1;
+        while (!getEntry(keyframe_index).is_keyframe) {
+            keyframe_index--;
+        }
+        std::fill(keyframe_state_.begin(), keyframe_state_.end(), 0);
+        decodeState(getEntry(keyframe_index), keyframe_state_.data());
+        states_since_keyframe_ = entry_count_ - 1 - keyframe_index;
+    }
+
+    return nes.loadState(state_.data(), state_.size());
+}
+
+void RewindBuffer::clear() {
+    write_offset_ = 0;
+    used_bytes_ = 0;
+    oldest_entry_ = 0;
+    entry_count_ = 0;
+    states_since_keyframe_ = 0;
+}
+
+uint32_t RewindBuffer::getFrameCount() const {
+    return entry_count_;
+}
+
+uint32_t RewindBuffer::getUsedBytes() const {
+    return used_bytes_;
+}
+
+uint32_t RewindBuffer::encodeState(const uint8_t* reference) {
+    const uint32_t state_size = state_.size();
+    const uint8_t* state = state_.data();
+    uint8_t* encoded_state = encoded_state_.data();
+    auto isUnchanged = [&](const uint32_t& index) {
+        return state[index] == (reference ? reference[index] : 0);
+    };
+
+    uint32_t encoded_size = 0;
+    uint32_t index = 0;
+    while (index < state_size) {
+        // Unchanged bytes are skipped 8 at a time first
+        uint32_t unchanged_length = 0;
+        while ((index + unchanged_length + 8 <= state_size) && (unchanged_length + 8 <= REWIND_BUFFER_MAX_RUN_LENGTH)) {
+            uint64_t state_word = 0;
+            uint64_t reference_word = 0;
+            std::memcpy(&state_word, state + index + unchanged_length, 8);
+            if (reference) {
+                std::memcpy(&reference_word, reference + index + unchanged_length, 8);
+            }
+            if (state_word != reference_word) {
+                break;
+            }
+            unchanged_length += 8;
+        }
+        while ((index + unchanged_length < state_size) && (unchanged_length < REWIND_BUFFER_MAX_RUN_LENGTH) && isUnchanged(index + unchanged_length)) {
+            unchanged_length++;
+        }
+        index += unchanged_length;
+
+        // Changed bytes run until enough unchanged bytes are found in a row
+        const uint32_t changed_start = index;
+        while ((index < state_size) && (index - changed_start < REWIND_BUFFER_MAX_RUN_LENGTH)) {
+            if ((index + REWIND_BUFFER_MIN_UNCHANGED_RUN_LENGTH <= state_size) && isUnchanged(index)) {
+                uint32_t length = 1;
+                while ((length < REWIND_BUFFER_MIN_UNCHANGED_RUN_LENGTH) && isUnchanged(index + length)) {
+                    length++;
+                }
+                if (length == REWIND_BUFFER_MIN_UNCHANGED_RUN_LENGTH) {
+                    break;
+                }
+            }
+            index++;
+        }
+        const uint32_t changed_length = index - changed_start;
+
+        encoded_state[encoded_size++] = unchanged_length & 0xFF;
+        encoded_state[encoded_size++] = unchanged_length >> 8;
+        encoded_state[encoded_size++] = changed_length & 0xFF;
+        encoded_state[encoded_size++] = changed_length >> 8;
+        for (uint32_t i = changed_start; i < index; i++) {
+            encoded_state[encoded_size++] = state[i] ^ (reference ? reference[i] : 0);
+        }
+    }
+    return encoded_size;
+}
+
+void RewindBuffer::decodeState(const Entry& entry, uint8_t* state) const {
+    const uint8_t* encoded_state = memory_.data() + entry.offset;
+    uint32_t encoded_index = 0;
+    uint32_t index = 0;
+    while (encoded_index < entry.size) {
+        const uint32_t unchanged_length = encoded_state[encoded_index] | (encoded_state[encoded_index + 1] << 8);
+        const uint32_t changed_length = encoded_state[encoded_index + 2] | (encoded_state[encoded_index + 3] << 8);
+        encoded_index += REWIND_BUFFER_RUN_HEADER_SIZE;
+
+        index += unchanged_length;
+        for (uint32_t i = 0; i < changed_length; i++) {
+            state[index++] ^= encoded_state[encoded_index++];
+        }
+    }
+}
+
+uint32_t RewindBuffer::allocateEntry(const uint32_t& size) {
+    uint32_t offset = write_offset_;
+    if (offset + size > memory_.size()) {
+        // The end of the memory is skipped, the states stored there are the oldest ones
+        while ((entry_count_ > 0) && (getEntry(0).offset >= offset)) {
+            evictOldestKeyframe();
+        }
+        offset = 0;
+    }
+
+    // States are evicted from the oldest, as they are stored right after the most recent one
+    while ((entry_count_ > 0) && (getEntry(0).offset < offset + size) && (offset < getEntry(0).offset + getEntry(0).size)) {
+        evictOldestKeyframe();
+    }
+    return offset;
+}
+
+void RewindBuffer::evictOldestKeyframe() {
+    // States after the keyframe can't be decoded without it
+    do {
+        used_bytes_ -= getEntry(0).size;
+        oldest_entry_ = (oldest_entry_ + 1) % entries_.size();
+        entry_count_--;
+    } while ((entry_count_ > 0) && !getEntry(0).is_keyframe);
+}
+
+const RewindBuffer::Entry& RewindBuffer::getEntry(const uint32_t& index) const {
+    return entries_[(oldest_entry_ + index) % entries_.size()];
+}
@@ -0,0 +1,85 @@
+#include "rom-image.hpp"
+// Standard Library Headers
+#include <array>
+#include <cstring>
+
+// Lookup table of the reflected CRC32 polynomial, 1 entry per byte value
+static constexpr std::array<uint32_t, 0x100> s_crc32_table = [] {
+    std::array<uint32_t, 0x100> table{};
+    for (uint32_t i = 0; i < table.size(); i++) {
+        uint32_t crc = i;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : (crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+std::mutex RomImage::s_cache_mutex_;
+std::unordered_map<uint32_t, std::weak_ptr<const RomImage>> RomImage::s_cache_;
+
+std::shared_ptr<const RomImage> RomImage::getRomImage(std::unique_ptr<uint8_t[]> rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size) {
+    const uint32_t crc32 = computeCRC32(rom_data.get(), prg_rom_size + chr_rom_size);
+
+    std::lock_guard<std::mutex> lock(s_cache_mutex_);
+    std::weak_ptr<const RomImage>& cached_image = s_cache_[crc32];
+    std::shared_ptr<const RomImage> image = cached_image.lock();
+    if (image && image->isSameRom(rom_data.get(), prg_rom_size, chr_rom_size)) {
+        return image;
+    }
+
+    const uint8_t* rom_data_pointer = rom_data.get();
+    std::shared_ptr<RomImage> new_image(new RomImage(std::shared_ptr<const uint8_t[]>(std::move(rom_data)), rom_data_pointer, prg_rom_size, chr_rom_size));
+    std::call_once(new_image->crc32_flag_, [&] { new_image->crc32_ = crc32; });
+    // A different ROM with the same CRC32 gets its own image, the cached one stays
+    if (!image) {
+        cached_image = new_image;
+    }
+    return new_image;
+}
+
+std::shared_ptr<const RomImage> RomImage::makeMappedRomImage(std::shared_ptr<const MappedFile> file, const uint64_t& offset, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size) {
+    if (!file || (offset + prg_rom_size + chr_rom_size > file->getSize())) {
+        return nullptr;
+    }
+    const uint8_t* rom_data = file->getData() + offset;
+    return std::shared_ptr<const RomImage>(new RomImage(std::move(file), rom_data, prg_rom_size, chr_rom_size));
+}
+
+uint32_t RomImage::computeCRC32(const uint8_t* data, const uint32_t& size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < size; i++) {
+        crc = s_crc32_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+const uint8_t* RomImage::getPrgRom() const {
+    return rom_data_;
+}
+
+uint32_t RomImage::getPrgRomSize() const {
+    return prg_rom_size_;
+}
+
+const uint8_t* RomImage::getChrRom() const {
+    return rom_data_ + prg_rom_size_;
+}
+
+uint32_t RomImage::getChrRomSize() const {
+    return chr_rom_size_;
+}
+
+uint32_t RomImage::getCRC32() const {
+    std::call_once(crc32_flag_, [this] { crc32_ = computeCRC32(rom_data_, prg_rom_size_ + chr_rom_size_); });
+    return crc32_;
+}
+
+RomImage::RomImage(std::shared_ptr<const void> rom_data_owner, const uint8_t* rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size): 
+    rom_data_owner_(std::move(rom_data_owner)), rom_data_(rom_data), prg_rom_size_(prg_rom_size), chr_rom_size_(chr_rom_size), crc32_(0) {}
+
+bool RomImage::isSameRom(const uint8_t* rom_data, const uint32_t& prg_rom_size, const uint32_t& chr_rom_size) const {
+    return (prg_rom_size == prg_rom_size_) && (chr_rom_size == chr_rom_size_) && 
+           (std::memcmp(rom_data, rom_data_, prg_rom_size + chr_rom_size) == 0);
+}
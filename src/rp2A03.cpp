@@ -2,16 +2,24 @@
 
 RP2A03::RP2A03(): 
     clock_count_(0),
+    apu_deferred_cycles_(0),
     dma_page_(0),
     dma_address_(0),
     dma_data_(0),
     dma_transfer_in_progress_(false),
-    dma_is_synced_(false) {}
+    dma_is_synced_(false),
+    perf_counters_(nullptr) {}
 
 void RP2A03::runCycle() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::CPU);
+
     clock_count_++;
 
-    apu_.clockAPU();
+    // The APU only runs when it is observed, or when it has fallen too far behind
+    apu_deferred_cycles_++;
+    if (apu_deferred_cycles_ >= RP2A03_MAX_APU_DEFERRED_CYCLES) {
+        catchUpAPU();
+    }
     
     if (dma_transfer_in_progress_) {
         if (!dma_is_synced_) {
@@ -41,6 +49,27 @@ void RP2A03::runCycle() {
     MOS6502::runCycle();
 }
 
+uint8_t RP2A03::runInstruction() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::CPU);
+
+    // The first cycle executes the instruction, or moves the DMA transfer forward
+    runCycle();
+
+    // A DMA transfer started by the instruction runs before the rest of the instruction's cycles
+    if (dma_transfer_in_progress_) {
+        return 1;
+    }
+
+    // The rest of the instruction's cycles only clock the APU, which is caught up later
+    const uint8_t remaining_cycles = instruction_cycle_remaining_;
+    clock_count_ += remaining_cycles;
+    apu_deferred_cycles_ += remaining_cycles;
+    cycles_elapsed_ += remaining_cycles;
+    instruction_cycle_remaining_ = 0;
+
+    return 1 + remaining_cycles;
+}
+
 void RP2A03::startDMATransfer(const uint8_t& page) {
     dma_page_ = page;
     dma_address_ = 0x00;
@@ -48,14 +77,74 @@ void RP2A03::startDMATransfer(const uint8_t& page) {
     dma_is_synced_ = false;
 }
 
+void RP2A03::setRegion(const APU::Region& region) {
+    catchUpAPU();
+    apu_.setRegion(region);
+}
+
+void RP2A03::catchUpAPU() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::APU);
+
+    for (; apu_deferred_cycles_ > 0; apu_deferred_cycles_--) {
+        apu_.clockAPU();
+    }
+}
+
+uint32_t RP2A03::getCyclesUntilAPUSequencerStep() const {
+    const uint32_t sequencer_countdown = apu_.getCyclesUntilSequencerStep();
+    return (apu_deferred_cycles_ < sequencer_countdown) ? (sequencer_countdown - apu_deferred_cycles_) : 0;
+}
+
 uint8_t RP2A03::readAPURegister(const uint8_t& address) {
+    catchUpAPU();
     return apu_.readAPURegister(address);
 }
 
 bool RP2A03::writeAPURegister(const uint8_t& address, const uint8_t& data) {
+    catchUpAPU();
     return apu_.writeAPURegister(address, data);
 }
 
+void RP2A03::saveState(SaveStateWriter& writer) const {
+    MOS6502::saveState(writer);
+    writer.write(clock_count_);
+    writer.write(apu_deferred_cycles_);
+    writer.write(dma_page_);
+    writer.write(dma_address_);
+    writer.write(dma_data_);
+    writer.write(dma_transfer_in_progress_);
+    writer.write(dma_is_synced_);
+    apu_.saveState(writer);
+}
+
+void RP2A03::loadState(SaveStateReader& reader) {
+    MOS6502::loadState(reader);
+    reader.read(clock_count_);
+    reader.read(apu_deferred_cycles_);
+    reader.read(dma_page_);
+    reader.read(dma_address_);
+    reader.read(dma_data_);
+    reader.read(dma_transfer_in_progress_);
+    reader.read(dma_is_synced_);
+    apu_.loadState(reader);
+}
+
 void RP2A03::connectSoundSystem(NESSound& sound_system) {
+    catchUpAPU();
     apu_.connectSoundSystem(sound_system);
 }
+
+void RP2A03::disconnectSoundSystem() {
+    catchUpAPU();
+    apu_.disconnectSoundSystem();
+}
+
+void RP2A03::connectPerfCounters(PerfCounters* perf_counters) {
+    perf_counters_ = perf_counters;
+    apu_.connectPerfCounters(perf_counters);
+}
+
+void RP2A03::endAudioFrame() {
+    catchUpAPU();
+    apu_.endAudioFrame();
+}
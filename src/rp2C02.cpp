@@ -1,5 +1,6 @@
 #include "rp2C02.hpp"
 #include <stdexcept>
+#include <algorithm>
 
 static uint8_t flipByte(uint8_t byte) {
     uint8_t result = 0x00;
@@ -20,28 +21,6 @@ bool RP2C02::Sprite::isFlippedVertically() const {
 }
 
 RP2C02::RP2C02(): 
-    colour_palette_({
-        // Thanks to OLC
-        { 84,  84,  84}, {  0,  30, 116}, {  8,  16, 144}, { 48,   0, 136},
-        { 68,   0, 100}, { 92,   0,  48}, { 84,   4,   0}, { 60,  24,   0},
-        { 32,  42,   0}, {  8,  58,   0}, {  0,  64,   0}, {  0,  60,   0},
-        {  0,  50,  60}, {  0,   0,   0}, {  0,   0,   0}, {  0,   0,   0},
-    
-        {152, 150, 152}, {  8,  76, 196}, { 48,  50, 236}, { 92,  30, 228},
-        {136,  20, 176}, {160,  20, 100}, {152,  34,  32}, {120,  60,   0},
-        { 84,  90,   0}, { 40, 114,   0}, {  8, 124,   0}, {  0, 118,  40},
-        {  0, 102, 120}, {  0,   0,   0}, {  0,   0,   0}, {  0,   0,   0},
-    
-        {236, 238, 236}, { 76, 154, 236}, {120, 124, 236}, {176,  98, 236},
-        {228,  84, 236}, {236,  88, 180}, {236, 106, 100}, {212, 136,  32},
-        {160, 170,   0}, {116, 196,   0}, { 76, 208,  32}, { 56, 204, 108},
-        { 56, 180, 204}, { 60,  60,  60}, {  0,   0,   0}, {  0,   0,   0},
-    
-        {236, 238, 236}, {168, 204, 236}, {188, 188, 236}, {212, 178, 236},
-        {236, 174, 236}, {236, 174, 212}, {236, 180, 176}, {228, 196, 144},
-        {204, 210, 120}, {180, 222, 120}, {168, 226, 144}, {152, 226, 180},
-        {160, 214, 228}, {160, 162, 160}, {  0,   0,   0}, {  0,   0,   0},
-    }),
     palette_table_({0}), oam_({.raw_data={0}}),
     control_register_({.raw_val=0x00}),
     mask_register_({.raw_val=0x00}),
@@ -51,23 +30,233 @@ RP2C02::RP2C02():
     loopy_t_register_({.raw_val=0x0000}),
     fine_x_scroll_(0), is_high_byte_selected_(true),
     data_buffer_(0), read_from_data_buffer_(false),
-    nmi_requested_(false), cycles_elapsed_(0), 
+    nmi_requested_(false), is_frame_complete_(false), cycles_elapsed_(0), 
     scanline_(0), scanline_cycle_(0), 
-    window_(nullptr), bus_(nullptr) {
+    deferred_cycles_(0),
+    is_scanline_renderer_enabled_(false), is_dot_accurate_scanline_(false), pending_dots_(0),
+    window_(nullptr), frame_buffer_(nullptr), bus_(nullptr), memory_pages_(nullptr), perf_counters_(nullptr) {
+    // Every sprite can be on the same scanline, reserved so loading a state doesn't allocate
+    sprites_at_next_scanline_.reserve(oam_.sprite_data.size());
 }
 
 void RP2C02::connectDisplayWindow(NESWindow* window) {
     window_ = window;
+    frame_buffer_ = (window_ != nullptr) ? window_->getFrameBuffer() : nullptr;
 }
 
 void RP2C02::connectBUS(BUS* target_bus) {
     bus_ = target_bus;
 }
 
+void RP2C02::connectMemoryPages(const std::array<const uint8_t*, RP2C02_MEMORY_PAGE_COUNT>* memory_pages) {
+    memory_pages_ = memory_pages;
+}
+
+void RP2C02::connectPerfCounters(PerfCounters* perf_counters) {
+    perf_counters_ = perf_counters;
+}
+
 void RP2C02::runCycle() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::PPU);
+
     // Increment on total PPU cycles elapsed
     cycles_elapsed_++;
 
+    // Every scanline starts out eligible for the scanline renderer
+    if (scanline_cycle_ == 0) {
+        is_dot_accurate_scanline_ = false;
+    }
+
+    // Defer the visible dots, they are rendered in one batch once the scanline reaches cycle 257
+    if (is_scanline_renderer_enabled_ && !is_dot_accurate_scanline_ &&
+        (0 <= scanline_) && (scanline_ <= 239) &&
+        (1 <= scanline_cycle_) && (scanline_cycle_ <= 256)) {
+        pending_dots_++;
+        scanline_cycle_++;
+        return;
+    }
+
+    if (pending_dots_ > 0) {
+        // All the visible dots are pending, nothing could have changed the PPU state in between
+        scanline_cycle_ -= pending_dots_;
+        if (pending_dots_ == 256) {
+            renderScanline();
+        }
+        else {
+            for (; pending_dots_ > 0; pending_dots_--) {
+                runDot();
+            }
+        }
+        pending_dots_ = 0;
+    }
+
+    runDot();
+}
+
+void RP2C02::deferCycles(const uint32_t& cycles) {
+    deferred_cycles_ += cycles;
+}
+
+uint32_t RP2C02::getCyclesUntilVBlank() const {
+    // The VBlank flag is set by scanline 241, cycle 1
+    return getCyclesUntilPosition(241, 1);
+}
+
+uint32_t RP2C02::getCyclesUntilFrameComplete() const {
+    // The frame complete flag is set by the last cycle of scanline 239
+    return getCyclesUntilPosition(239, RP2C02_CYCLES_PER_SCANLINE - 1);
+}
+
+uint32_t RP2C02::getCyclesUntilPosition(const int16_t& scanline, const uint16_t& scanline_cycle) const {
+    // Position of the next cycle to run after the deferred ones, and of the cycle to reach
+    const uint32_t frame_position = ((scanline_ + 1) * RP2C02_CYCLES_PER_SCANLINE + scanline_cycle_ + deferred_cycles_) % RP2C02_CYCLES_PER_FRAME;
+    const uint32_t target_position = (scanline + 1) * RP2C02_CYCLES_PER_SCANLINE + scanline_cycle;
+    return (target_position + RP2C02_CYCLES_PER_FRAME - frame_position) % RP2C02_CYCLES_PER_FRAME + 1;
+}
+
+void RP2C02::catchUp() {
+    NES_PERF_SCOPE(perf_counters_, PerfCounters::Subsystem::PPU);
+
+    for (; deferred_cycles_ > 0; deferred_cycles_--) {
+        runCycle();
+    }
+}
+
+void RP2C02::setScanlineRendererEnabled(const bool& value) {
+    syncScanline();
+    is_scanline_renderer_enabled_ = value;
+}
+
+void RP2C02::syncScanline() {
+    if (!is_scanline_renderer_enabled_) return;
+
+    // Catch up the deferred dots using the dot-accurate renderer
+    scanline_cycle_ -= pending_dots_;
+    for (; pending_dots_ > 0; pending_dots_--) {
+        runDot();
+    }
+    // The rest of the scanline must observe the register access at the exact dot
+    is_dot_accurate_scanline_ = true;
+}
+
+void RP2C02::renderScanline() {
+    // No register can change during the batch, so the render settings are fixed for the whole scanline
+    const bool is_background_enabled = mask_register_.BACKGROUND_ENABLE;
+    const bool is_sprite_enabled = mask_register_.SPRITE_ENABLE;
+    const bool is_rendering_left_most_pixels = isRenderLeftMostPixelsEnabled();
+    const bool is_render_enabled = isRenderEnabled();
+    const uint16_t background_pattern_table_address = control_register_.BACKGROUND_PATTERN_TABLE * 0x1000;
+    const uint16_t scroll_x_mask = 0x8000 >> fine_x_scroll_;
+    const uint8_t sprite_count = std::min(sprites_at_next_scanline_.size(), static_cast<size_t>(8));
+    uint16_t* scanline_frame_buffer = (frame_buffer_ != nullptr) ? frame_buffer_ + scanline_ * NES_WINDOW_WIDTH : nullptr;
+
+    for (scanline_cycle_ = 1; scanline_cycle_ <= 256; scanline_cycle_++) {
+        // Background fetches, the fetch pipeline starts at cycle 2
+        if (scanline_cycle_ >= 2) {
+            if (is_background_enabled) {
+                shiftBackgroundShifters();
+            }
+
+            switch ((scanline_cycle_ - 1) % 8) {
+                case 0:
+                loadBackgroundShifers(bg_next_tile_lsb_, bg_next_tile_msb_, bg_next_tile_palette_id_);
+                break;
+                case 1:
+                bg_next_tile_id_ = readMemoryPage(0x2000 | (loopy_v_register_.raw_val & 0x0FFF));
+                break;
+                case 3: {
+                    uint16_t attribute_address = 0x23C0 | 
+                        (loopy_v_register_.NAMETABLE_Y << 11) | 
+                        (loopy_v_register_.NAMETABLE_X << 10) |
+                        ((loopy_v_register_.COARSE_Y >> 2) << 3) | 
+                        (loopy_v_register_.COARSE_X >> 2);
+                    // Shift the quadrant of the tile down to the lowest 2 bits
+                    uint8_t attribute_shift = ((loopy_v_register_.COARSE_Y & 0x02) << 1) | (loopy_v_register_.COARSE_X & 0x02);
+                    bg_next_tile_palette_id_ = (readMemoryPage(attribute_address) >> attribute_shift) & 0b00000011;
+                }
+                break;
+                case 5:
+                bg_next_tile_lsb_ = readMemoryPage(background_pattern_table_address + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 0);
+                break;
+                case 7:
+                bg_next_tile_msb_ = readMemoryPage(background_pattern_table_address + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 8);
+                increaseScrollX();
+                break;
+            }
+        }
+
+        if (scanline_cycle_ == 256) {
+            increaseScrollY();
+        }
+
+        uint8_t bg_pixel_colour_value = 0x00;
+        uint8_t bg_palette_id = 0x00;
+        if (is_background_enabled) {
+            bg_pixel_colour_value = (((bg_shifter_pattern_hi_ & scroll_x_mask) > 0) << 1) | ((bg_shifter_pattern_lo_ & scroll_x_mask) > 0);
+            bg_palette_id = (((bg_shifter_palette_hi_ & scroll_x_mask) > 0) << 1) | ((bg_shifter_palette_lo_ & scroll_x_mask) > 0);
+        }
+
+        uint8_t sprite_pixel_colour_value = 0x00;
+        uint8_t sprite_palette_id = 0x00;
+        uint8_t sprite_z_index = 0x00;
+        bool is_sprite_zero_being_rendered = false;
+
+        if (is_sprite_enabled) {
+            for (uint8_t sprite_index = 0; sprite_index < sprite_count; sprite_index++) {
+                const Sprite& sprite = sprites_at_next_scanline_[sprite_index];
+                if (sprite.x_position > 0) {
+                    continue;
+                }
+
+                sprite_pixel_colour_value = (((sprite_shifter_pattern_hi_[sprite_index] & 0x80) > 0) << 1) | ((sprite_shifter_pattern_lo_[sprite_index] & 0x80) > 0);
+                sprite_palette_id = (sprite.attribute & 0x03) + 0x04;
+                sprite_z_index = (sprite.attribute & 0x20) == 0;
+
+                if (sprite_pixel_colour_value != 0x00) {
+                    is_sprite_zero_being_rendered = (sprite_index == 0) && is_sprite_zero_in_next_scanline_;
+                    break;
+                }
+            }
+
+            for (uint8_t sprite_index = 0; sprite_index < sprite_count; sprite_index++) {
+                Sprite& sprite = sprites_at_next_scanline_[sprite_index];
+                if (sprite.x_position > 0) {
+                    sprite.x_position--;
+                    continue;
+                }
+                sprite_shifter_pattern_lo_[sprite_index] <<= 1;
+                sprite_shifter_pattern_hi_[sprite_index] <<= 1;
+            }
+        }
+
+        uint8_t final_pixel_colour_value = bg_pixel_colour_value;
+        uint8_t final_palette_id = bg_palette_id;
+
+        if (sprite_pixel_colour_value != 0x00) {
+            if ((bg_pixel_colour_value == 0x00) || (sprite_z_index > 0)) {
+                final_pixel_colour_value = sprite_pixel_colour_value;
+                final_palette_id = sprite_palette_id;
+            }
+
+            // Sprite zero hit needs both pixels to be opaque, and is skipped on the left-most 8 pixels unless they are rendered
+            if ((bg_pixel_colour_value != 0x00) && is_sprite_zero_being_rendered && is_render_enabled &&
+                (is_rendering_left_most_pixels || (scanline_cycle_ > 8))) {
+                status_register_.SPRITE_ZERO_HIT = 1;
+            }
+        }
+        else if (bg_pixel_colour_value == 0x00) {
+            final_palette_id = 0x00;
+        }
+
+        if (scanline_frame_buffer != nullptr) {
+            scanline_frame_buffer[scanline_cycle_ - 1] = getPixelFromPalette(final_palette_id, final_pixel_colour_value);
+        }
+    }
+
+    completeScanline();
+}
+
+void RP2C02::runDot() {
     // Skip scanline cycle 0 for scanline 0
     if ((scanline_ == 0) && (scanline_cycle_ == 0)) {
         scanline_cycle_ = 1;
@@ -114,7 +303,7 @@ void RP2C02::runCycle() {
                 break;
                 // Fetch name table data
                 case 1:
-                bg_next_tile_id_ = bus_->readBusData(0x2000 | (loopy_v_register_.raw_val & 0x0FFF));
+                bg_next_tile_id_ = readMemoryPage(0x2000 | (loopy_v_register_.raw_val & 0x0FFF));
                 break;
                 // Fetch attribute table data
                 case 3: {
@@ -125,7 +314,7 @@ void RP2C02::runCycle() {
                         ((loopy_v_register_.COARSE_Y >> 2) << 3) | 
                         (loopy_v_register_.COARSE_X >> 2);
                     
-                    bg_next_tile_palette_id_ = bus_->readBusData(attribute_address);
+                    bg_next_tile_palette_id_ = readMemoryPage(attribute_address);
 
                     // We extract the palette ID from the quadrant where the tile is located
                     uint8_t attribute_block_x = loopy_v_register_.COARSE_X % 4;
@@ -150,12 +339,12 @@ void RP2C02::runCycle() {
                 break;
                 // Fetch LSB of tile data from pattern table
                 case 5:
-                bg_next_tile_lsb_ = bus_->readBusData(control_register_.BACKGROUND_PATTERN_TABLE * 0x1000 + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 0);
+                bg_next_tile_lsb_ = readMemoryPage(control_register_.BACKGROUND_PATTERN_TABLE * 0x1000 + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 0);
                 break;
                 // Fetch MSB of tile data from pattern table and increment scroll X
                 case 7:
                 // Fetch MSB of tile data from pattern table
-                bg_next_tile_msb_ = bus_->readBusData(control_register_.BACKGROUND_PATTERN_TABLE * 0x1000 + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 8);
+                bg_next_tile_msb_ = readMemoryPage(control_register_.BACKGROUND_PATTERN_TABLE * 0x1000 + bg_next_tile_id_ * 0x10 + loopy_v_register_.FINE_Y + 8);
                 // Increment the scroll X register
                 increaseScrollX();
                 break;
@@ -176,7 +365,7 @@ void RP2C02::runCycle() {
 
         // Weird unnecessary tile read at the end of the scanline
         if ((scanline_cycle_ == 338) || (scanline_cycle_ == 340)) {
-            bg_next_tile_id_ = bus_->readBusData(0x2000 | (loopy_v_register_.raw_val & 0x0FFF));
+            bg_next_tile_id_ = readMemoryPage(0x2000 | (loopy_v_register_.raw_val & 0x0FFF));
         }
 
         // Pre-render scanline
@@ -241,8 +430,8 @@ void RP2C02::runCycle() {
                 }
 
                 // Read the tile data from the pattern table
-                uint8_t tile_pattern_lsb = bus_->readBusData(sprite_pattern_table * 0x1000 + sprite_tile_id * 0x10 + tile_pixel_y + 0);
-                uint8_t tile_pattern_msb = bus_->readBusData(sprite_pattern_table * 0x1000 + sprite_tile_id * 0x10 + tile_pixel_y + 8);
+                uint8_t tile_pattern_lsb = readMemoryPage(sprite_pattern_table * 0x1000 + sprite_tile_id * 0x10 + tile_pixel_y + 0);
+                uint8_t tile_pattern_msb = readMemoryPage(sprite_pattern_table * 0x1000 + sprite_tile_id * 0x10 + tile_pixel_y + 8);
 
                 if (sprite.isFlippedHorizontally()) {
                     tile_pattern_lsb = flipByte(tile_pattern_lsb);
@@ -324,8 +513,13 @@ void RP2C02::runCycle() {
         }
     }
 
-    if (window_ != nullptr) {
-        window_->setPixel(scanline_cycle_ - 1, scanline_, getColourFromPalette(final_palette_id, final_pixel_colour_value));
+    // Only the visible dots are displayed
+    if ((frame_buffer_ != nullptr) && (0 <= scanline_) && (scanline_ <= 239) &&
+        (1 <= scanline_cycle_) && (scanline_cycle_ <= 256)) {
+        frame_buffer_[scanline_ * NES_WINDOW_WIDTH + (scanline_cycle_ - 1)] = getPixelFromPalette(final_palette_id, final_pixel_colour_value);
+        if (scanline_cycle_ == 256) {
+            completeScanline();
+        }
     }
 
     // Scanline and Scanline Cycle Increment
@@ -338,6 +532,9 @@ void RP2C02::runCycle() {
         }
         else {
             scanline_++;
+            if (scanline_ == 240) {
+                is_frame_complete_ = true;
+            }
         }
     }
 }
@@ -356,6 +553,10 @@ bool RP2C02::writePaletteTable(const uint16_t& address, const uint8_t& data) {
 }
 
 uint8_t RP2C02::readRegister(const uint8_t& address) {
+    // Register reads must observe the PPU state at the current dot
+    catchUp();
+    syncScanline();
+
     uint8_t return_value = 0x00;
 
     switch (address & 0b00000111) {
@@ -396,6 +597,10 @@ uint8_t RP2C02::readRegister(const uint8_t& address) {
 }
 
 bool RP2C02::writeRegister(const uint8_t& address, const uint8_t& data) {
+    // Register writes must only affect the dots after the current dot
+    catchUp();
+    syncScanline();
+
     bool write_success = false;
 
     switch (address & 0b00000111) {
@@ -470,6 +675,14 @@ void RP2C02::setNMIFlag(const bool& value) {
     nmi_requested_ = value;
 }
 
+bool RP2C02::getFrameCompleteFlag() const {
+    return is_frame_complete_;
+}
+
+void RP2C02::setFrameCompleteFlag(const bool& value) {
+    is_frame_complete_ = value;
+}
+
 bool RP2C02::isRenderEnabled() const {
     return (mask_register_.BACKGROUND_ENABLE || mask_register_.SPRITE_ENABLE);
 }
@@ -572,8 +785,18 @@ void RP2C02::shiftSpriteShifters(const uint8_t& sprite_index) {
     sprite_shifter_pattern_hi_.at(sprite_index) <<= 1;
 }
 
+uint16_t RP2C02::getPixelFromPalette(const uint8_t& palette_id, const uint8_t& pixel_colour_value) const {
+    // Same mapping as the palette table mirroring on the PPU BUS, transparent colours share the backdrop entry
+    uint8_t palette_address = (palette_id << 2) | pixel_colour_value;
+    if (palette_address % 4 == 0) {
+        palette_address &= 0x000F;
+    }
+    return (palette_table_[palette_address] & NES_WINDOW_PIXEL_PALETTE_INDEX_MASK) | 
+           (mask_register_.COLOUR_EMPHASIS << NES_WINDOW_PIXEL_EMPHASIS_SHIFT);
+}
+
 NESWindow::Colour RP2C02::getColourFromPalette(const uint8_t& palette_id, const uint8_t& pixel_colour_value) const {
-    return colour_palette_.at(bus_->readBusData(0x3F00 + ((palette_id << 2) | pixel_colour_value)) % colour_palette_.size());
+    return NESWindow::system_palette.at(bus_->readBusData(0x3F00 + ((palette_id << 2) | pixel_colour_value)) % NESWindow::system_palette.size());
 }
 
 RP2C02::Tile RP2C02::getTileFromPatternTable(const uint8_t& tile_index, const uint8_t& palette_id, const uint8_t& pattern_table_index) const {
@@ -618,3 +841,98 @@ void RP2C02::searchSpritesAtScanline(const int16_t& scanline) {
         }
     }
 }
+
+uint8_t RP2C02::readMemoryPage(const uint16_t& address) const {
+    return (*memory_pages_)[address / RP2C02_MEMORY_PAGE_SIZE][address % RP2C02_MEMORY_PAGE_SIZE];
+}
+
+void RP2C02::completeScanline() {
+    if (window_ == nullptr) {
+        return;
+    }
+
+    window_->onScanline(scanline_);
+    if (scanline_ == 239) {
+        window_->onFrameComplete();
+    }
+}
+
+void RP2C02::saveState(SaveStateWriter& writer) const {
+    writer.write(palette_table_);
+    writer.write(oam_);
+    writer.write(control_register_);
+    writer.write(mask_register_);
+    writer.write(status_register_);
+    writer.write(oam_address_);
+    writer.write(oam_data_);
+    writer.write(loopy_v_register_);
+    writer.write(loopy_t_register_);
+    writer.write(fine_x_scroll_);
+    writer.write(is_high_byte_selected_);
+    writer.write(data_buffer_);
+    writer.write(read_from_data_buffer_);
+    writer.write(nmi_requested_);
+    writer.write(is_frame_complete_);
+    writer.write(cycles_elapsed_);
+    writer.write(scanline_);
+    writer.write(scanline_cycle_);
+    writer.write(deferred_cycles_);
+    writer.write(is_dot_accurate_scanline_);
+    writer.write(pending_dots_);
+    writer.write(bg_next_tile_id_);
+    writer.write(bg_next_tile_palette_id_);
+    writer.write(bg_next_tile_lsb_);
+    writer.write(bg_next_tile_msb_);
+    writer.write(bg_shifter_pattern_lo_);
+    writer.write(bg_shifter_pattern_hi_);
+    writer.write(bg_shifter_palette_lo_);
+    writer.write(bg_shifter_palette_hi_);
+    writer.write(is_sprite_zero_in_next_scanline_);
+    // Sprites are saved into a fixed size block, so every state has the same size
+    std::array<Sprite, 0x40> sprites = {};
+    std::copy(sprites_at_next_scanline_.begin(), sprites_at_next_scanline_.end(), sprites.begin());
+    writer.write(static_cast<uint8_t>(sprites_at_next_scanline_.size()));
+    writer.write(sprites);
+    writer.write(sprite_shifter_pattern_lo_);
+    writer.write(sprite_shifter_pattern_hi_);
+}
+
+void RP2C02::loadState(SaveStateReader& reader) {
+    reader.read(palette_table_);
+    reader.read(oam_);
+    reader.read(control_register_);
+    reader.read(mask_register_);
+    reader.read(status_register_);
+    reader.read(oam_address_);
+    reader.read(oam_data_);
+    reader.read(loopy_v_register_);
+    reader.read(loopy_t_register_);
+    reader.read(fine_x_scroll_);
+    reader.read(is_high_byte_selected_);
+    reader.read(data_buffer_);
+    reader.read(read_from_data_buffer_);
+    reader.read(nmi_requested_);
+    reader.read(is_frame_complete_);
+    reader.read(cycles_elapsed_);
+    reader.read(scanline_);
+    reader.read(scanline_cycle_);
+    reader.read(deferred_cycles_);
+    reader.read(is_dot_accurate_scanline_);
+    reader.read(pending_dots_);
+    reader.read(bg_next_tile_id_);
+    reader.read(bg_next_tile_palette_id_);
+    reader.read(bg_next_tile_lsb_);
+    reader.read(bg_next_tile_msb_);
+    reader.read(bg_shifter_pattern_lo_);
+    reader.read(bg_shifter_pattern_hi_);
+    reader.read(bg_shifter_palette_lo_);
+    reader.read(bg_shifter_palette_hi_);
+    reader.read(is_sprite_zero_in_next_scanline_);
+    uint8_t sprite_count = 0;
+    std::array<Sprite, 0x40> sprites = {};
+    reader.read(sprite_count);
+    reader.read(sprites);
+    sprites_at_next_scanline_.assign(sprites.begin(), sprites.begin() + std::min<size_t>(sprite_count, sprites.size()));
+    reader.read(sprite_shifter_pattern_lo_);
+    reader.read(sprite_shifter_pattern_hi_);
+}
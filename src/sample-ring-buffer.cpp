@@ -0,0 +1,50 @@
+#include "sample-ring-buffer.hpp"
+// Standard Library Headers
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+SampleRingBuffer::SampleRingBuffer(const uint32_t& capacity):
+    capacity_(std::bit_ceil(std::max<uint32_t>(capacity, 1))), index_mask_(capacity_ - 1),
+    samples_(std::make_unique<int16_t[]>(capacity_)), write_index_(0), read_index_(0) {}
+
+uint32_t SampleRingBuffer::write(const int16_t* samples, const uint32_t& sample_count) {
+    const uint32_t write_index = write_index_.load(std::memory_order_relaxed);
+    // Acquire so the reader is done with the samples it has released
+    const uint32_t read_index = read_index_.load(std::memory_order_acquire);
+    const uint32_t count = std::min(sample_count, capacity_ - (write_index - read_index));
+
+    // Copy in up to two parts when the samples wrap past the end of the ring
+    const uint32_t offset = write_index & index_mask_;
+    const uint32_t first_count = std::min(count, capacity_ - offset);
+    std::memcpy(samples_.get() + offset, samples, first_count * sizeof(int16_t));
+    std::memcpy(samples_.get(), samples + first_count, (count - first_count) * sizeof(int16_t));
+
+    // Release so the reader sees the samples before the new index
+    write_index_.store(write_index + count, std::memory_order_release);
+    return count;
+}
+
+uint32_t SampleRingBuffer::read(int16_t* samples, const uint32_t& sample_count) {
+    const uint32_t read_index = read_index_.load(std::memory_order_relaxed);
+    const uint32_t write_index = write_index_.load(std::memory_order_acquire);
+    const uint32_t count = std::min(sample_count, write_index - read_index);
+
+    const uint32_t offset = read_index & index_mask_;
+    const uint32_t first_count = std::min(count, capacity_ - offset);
+    std::memcpy(samples, samples_.get() + offset, first_count * sizeof(int16_t));
+    std::memcpy(samples + first_count, samples_.get(), (count - first_count) * sizeof(int16_t));
+
+    read_index_.store(read_index + count, std::memory_order_release);
+    return count;
+}
+
+uint32_t SampleRingBuffer::getFillLevel() const {
+    // The read index is loaded first so it can't pass the write index, the difference stays valid when they wrap around
+    const uint32_t read_index = read_index_.load(std::memory_order_acquire);
+    return write_index_.load(std::memory_order_acquire) - read_index;
+}
+
+uint32_t SampleRingBuffer::getCapacity() const {
+    return capacity_;
+}
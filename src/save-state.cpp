@@ -0,0 +1,35 @@
+#include "save-state.hpp"
+
+SaveStateWriter::SaveStateWriter(uint8_t* buffer, const uint32_t& buffer_size): 
+    buffer_(buffer), buffer_size_(buffer_size), offset_(0) {}
+
+void SaveStateWriter::writeBytes(const uint8_t* data, const uint32_t& size) {
+    if (isValid() && (buffer_ != nullptr) && (size <= buffer_size_ - offset_)) {
+        std::memcpy(buffer_ + offset_, data, size);
+    }
+    offset_ += size;
+}
+
+uint32_t SaveStateWriter::getSize() const {
+    return offset_;
+}
+
+bool SaveStateWriter::isValid() const {
+    return (buffer_ != nullptr) && (offset_ <= buffer_size_);
+}
+
+SaveStateReader::SaveStateReader(const uint8_t* buffer, const uint32_t& buffer_size): 
+    buffer_(buffer), buffer_size_(buffer_size), offset_(0), is_valid_(buffer != nullptr) {}
+
+void SaveStateReader::readBytes(uint8_t* data, const uint32_t& size) {
+    if (!is_valid_ || (size > buffer_size_ - offset_)) {
+        is_valid_ = false;
+        return;
+    }
+    std::memcpy(data, buffer_ + offset_, size);
+    offset_ += size;
+}
+
+bool SaveStateReader::isValid() const {
+    return is_valid_;
+}
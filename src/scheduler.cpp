@@ -0,0 +1,43 @@
+#include "scheduler.hpp"
+
+Scheduler::Scheduler(): next_event_(Event::PPU_VBLANK), next_event_time_(SCHEDULER_NO_EVENT) {
+    clear();
+}
+
+void Scheduler::schedule(const Event& event, const uint64_t& time) {
+    event_times_[static_cast<uint8_t>(event)] = time;
+    updateNextEvent();
+}
+
+void Scheduler::cancel(const Event& event) {
+    schedule(event, SCHEDULER_NO_EVENT);
+}
+
+void Scheduler::clear() {
+    event_times_.fill(SCHEDULER_NO_EVENT);
+    updateNextEvent();
+}
+
+uint64_t Scheduler::getNextEventTime() const {
+    return next_event_time_;
+}
+
+bool Scheduler::popDueEvent(const uint64_t& time, Event& event) {
+    if ((next_event_time_ == SCHEDULER_NO_EVENT) || (next_event_time_ > time)) {
+        return false;
+    }
+    event = next_event_;
+    cancel(event);
+    return true;
+}
+
+void Scheduler::updateNextEvent() {
+    // There are only a few kinds of events, so a scan is cheaper than keeping a heap
+    next_event_time_ = SCHEDULER_NO_EVENT;
+    for (uint8_t i = 0; i < event_times_.size(); i++) {
+        if (event_times_[i] < next_event_time_) {
+            next_event_time_ = event_times_[i];
+            next_event_ = static_cast<Event>(i);
+        }
+    }
+}
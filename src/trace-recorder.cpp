@@ -0,0 +1,104 @@
+#include "trace-recorder.hpp"
+// Standard Library Headers
+#include <algorithm>
+#include <bit>
+#include <iomanip>
+
+TraceRecorder::Scope::Scope(const char* name): name_(nullptr) {
+    TraceRecorder& recorder = TraceRecorder::getInstance();
+    if (recorder.isRecording()) {
+        name_ = name;
+        recorder.record(name_, 'B');
+    }
+}
+
+TraceRecorder::Scope::~Scope() {
+    if (name_) {
+        TraceRecorder::getInstance().record(name_, 'E');
+    }
+}
+
+TraceRecorder::TraceRecorder(): is_recording_(false), events_(nullptr), event_mask_(0), write_index_(0), start_time_() {}
+
+TraceRecorder& TraceRecorder::getInstance() {
+    static TraceRecorder s_instance;
+    return s_instance;
+}
+
+void TraceRecorder::start(const uint32_t& event_capacity) {
+    const uint64_t capacity = std::bit_ceil(std::max<uint64_t>(event_capacity, 1));
+    events_ = std::make_unique<Event[]>(capacity);
+    event_mask_ = capacity - 1;
+    write_index_.store(0, std::memory_order_relaxed);
+    start_time_ = std::chrono::steady_clock::now();
+    is_recording_.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::stop() {
+    is_recording_.store(false, std::memory_order_release);
+}
+
+bool TraceRecorder::isRecording() const {
+    return is_recording_.load(std::memory_order_acquire);
+}
+
+void TraceRecorder::record(const char* name, const char& phase) {
+    if (!isRecording()) {
+        return;
+    }
+
+    const uint64_t index = write_index_.fetch_add(1, std::memory_order_relaxed);
+    Event& event = events_[index & event_mask_];
+
+    // The slot is marked as being written, so a writer of the trace skips it
+    event.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.timestamp.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count(), 
+        std::memory_order_relaxed);
+    event.thread_id.store(getThreadID(), std::memory_order_relaxed);
+    event.phase.store(phase, std::memory_order_relaxed);
+    event.sequence.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream& stream) const {
+    stream << "{\"traceEvents\":[";
+
+    if (events_) {
+        const uint64_t end_index = write_index_.load(std::memory_order_acquire);
+        const uint64_t capacity = event_mask_ + 1;
+        const uint64_t start_index = (end_index > capacity) ? (end_index - capacity) : 0;
+
+        bool is_first_event = true;
+        for (uint64_t index = start_index; index < end_index; index++) {
+            const Event& event = events_[index & event_mask_];
+            if (event.sequence.load(std::memory_order_acquire) != index + 1) {
+                continue;
+            }
+            const char* name = event.name.load(std::memory_order_relaxed);
+            const uint64_t timestamp = event.timestamp.load(std::memory_order_relaxed);
+            const uint32_t thread_id = event.thread_id.load(std::memory_order_relaxed);
+            const char phase = event.phase.load(std::memory_order_relaxed);
+            // Skip the event if it was overwritten while being copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (event.sequence.load(std::memory_order_relaxed) != index + 1) {
+                continue;
+            }
+
+            // Timestamps are in microseconds
+            stream << (is_first_event ? "\n" : ",\n");
+            stream << "{\"name\":\"" << name << "\",\"ph\":\"" << phase << "\",\"ts\":" << (timestamp / 1000) << "."
+                   << std::setw(3) << std::setfill('0') << (timestamp % 1000) << std::setfill(' ')
+                   << ",\"pid\":1,\"tid\":" << thread_id << "}";
+            is_first_event = false;
+        }
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+uint32_t TraceRecorder::getThreadID() {
+    static std::atomic<uint32_t> s_next_thread_id{1};
+    thread_local const uint32_t s_thread_id = s_next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return s_thread_id;
+}